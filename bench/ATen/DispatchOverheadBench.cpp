@@ -0,0 +1,200 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/abs.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/full.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/sum.h>
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+#include <torch/library.h>
+#if !USE_PADDLE_API
+#include <ATen/core/dispatch/Dispatcher.h>
+#endif
+
+#include <string>
+
+#include "bench/common/benchmark.h"
+#include "bench/common/registered_kernel.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+#if USE_PADDLE_API
+using paddle_api_test::RegisteredKernel;
+#endif
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SubtractEmptyCallBaseline;
+
+static at::Tensor bench_identity(const at::Tensor& t) { return t; }
+
+// 两端都经 TORCH_LIBRARY 注册；Paddle compat 的 def 不推导函数签名，
+// 内核以读取 FunctionArgs 的 CppFunction 由 impl 注册
+TORCH_LIBRARY(paddle_api_bench, m) {
+#if USE_PADDLE_API
+  m.def("identity(Tensor self) -> Tensor");
+  m.impl("identity",
+         torch::CppFunction(
+             [](const torch::FunctionArgs& args) -> torch::IValue {
+               return torch::IValue(bench_identity(args.get<at::Tensor>(0)));
+             }));
+#else
+  m.def("identity(Tensor self) -> Tensor", &bench_identity);
+#endif
+}
+
+// 以 0 / 1 元素 tensor 测量每次调用的固定开销，扣除空函数基线后记为
+// net_ns。每个算子族尽量拆成以下阶段，便于定位 compat 包装的额外开销：
+//   pack     框架的实参装箱（Torch 的 IValue 栈 / Paddle compat 的
+//            FunctionArgs）
+//   options  TensorOptions 构造与解析
+//   alloc    输出 tensor 分配
+//   dispatch 不含输出分配的调用（原地或 _out 变体）
+//   full     完整调用
+template <typename Fn>
+static void run_stage(const std::string& family,
+                      const std::string& stage,
+                      int64_t numel,
+                      Fn&& fn) {
+  BenchmarkResult result = RunBenchmark(
+      family + "/" + stage + "/numel=" + std::to_string(numel), fn);
+  SubtractEmptyCallBaseline(&result);
+  result.addLabel("family", family);
+  result.addLabel("stage", stage);
+  ReportBenchmark(result);
+}
+
+class DispatchOverheadBench : public ::testing::Test {
+ protected:
+  static constexpr int64_t kNumels[] = {0, 1};
+};
+
+TEST_F(DispatchOverheadBench, ViewOps) {
+  for (int64_t numel : kNumels) {
+    at::Tensor x = at::zeros({numel}, at::kFloat);
+    run_stage("view", "full/view", numel, [&] {
+      at::Tensor r = x.view({numel});
+      DoNotOptimize(r);
+    });
+    run_stage("view", "full/reshape", numel, [&] {
+      at::Tensor r = x.reshape({numel});
+      DoNotOptimize(r);
+    });
+    run_stage("view", "full/unsqueeze", numel, [&] {
+      at::Tensor r = x.unsqueeze(0);
+      DoNotOptimize(r);
+    });
+    run_stage("view", "full/transpose", numel, [&] {
+      at::Tensor r = x.transpose(0, 0);
+      DoNotOptimize(r);
+    });
+    run_stage("view", "full/slice", numel, [&] {
+      at::Tensor r = x.slice(0, 0, numel);
+      DoNotOptimize(r);
+    });
+  }
+}
+
+TEST_F(DispatchOverheadBench, Factories) {
+  for (int64_t numel : kNumels) {
+    const at::TensorOptions opts =
+        at::TensorOptions().dtype(at::kFloat).device(at::kCPU);
+    run_stage("factory", "options", numel, [&] {
+      at::TensorOptions o =
+          at::TensorOptions().dtype(at::kFloat).device(at::kCPU);
+      DoNotOptimize(o);
+    });
+    run_stage("factory", "alloc", numel, [&] {
+      at::Tensor r = at::empty({numel}, opts);
+      DoNotOptimize(r);
+    });
+    run_stage("factory", "full/zeros", numel, [&] {
+      at::Tensor r = at::zeros({numel}, opts);
+      DoNotOptimize(r);
+    });
+    run_stage("factory", "full/ones", numel, [&] {
+      at::Tensor r = at::ones({numel}, opts);
+      DoNotOptimize(r);
+    });
+    run_stage("factory", "full/full", numel, [&] {
+      at::Tensor r = at::full({numel}, 1.5, opts);
+      DoNotOptimize(r);
+    });
+  }
+}
+
+TEST_F(DispatchOverheadBench, Elementwise) {
+  for (int64_t numel : kNumels) {
+    at::Tensor x = at::ones({numel}, at::kFloat);
+    at::Tensor inplace = at::ones({numel}, at::kFloat);
+    run_stage("elementwise", "alloc", numel, [&] {
+      at::Tensor r = at::empty_like(x);
+      DoNotOptimize(r);
+    });
+    run_stage("elementwise", "dispatch/abs_", numel, [&] {
+      at::Tensor& r = inplace.abs_();
+      DoNotOptimize(r);
+    });
+    run_stage("elementwise", "full/abs", numel, [&] {
+      at::Tensor r = at::abs(x);
+      DoNotOptimize(r);
+    });
+  }
+}
+
+TEST_F(DispatchOverheadBench, Reductions) {
+  for (int64_t numel : kNumels) {
+    at::Tensor x = at::ones({numel}, at::kFloat);
+    at::Tensor out = at::empty({}, at::kFloat);
+    run_stage("reduction", "alloc", numel, [&] {
+      at::Tensor r = at::empty({}, at::kFloat);
+      DoNotOptimize(r);
+    });
+    run_stage("reduction", "dispatch/sum_out", numel, [&] {
+      at::Tensor& r = at::sum_out(out, x);
+      DoNotOptimize(r);
+    });
+    run_stage("reduction", "full/sum", numel, [&] {
+      at::Tensor r = at::sum(x);
+      DoNotOptimize(r);
+    });
+  }
+}
+
+// 两端都在计时前按名查找一次 TORCH_LIBRARY 注册的算子：Torch 经
+// c10::Dispatcher 取得 TypedOperatorHandle；Paddle compat 没有 Dispatcher，
+// 从 OperatorRegistry 取出注册时保存的 CppFunction
+TEST_F(DispatchOverheadBench, Library) {
+#if USE_PADDLE_API
+  const torch::CppFunction& op = RegisteredKernel("paddle_api_bench::identity");
+#else
+  auto op = c10::Dispatcher::singleton()
+                .findSchemaOrThrow("paddle_api_bench::identity", "")
+                .typed<at::Tensor(const at::Tensor&)>();
+#endif
+  for (int64_t numel : kNumels) {
+    at::Tensor x = at::zeros({numel}, at::kFloat);
+    run_stage("library", "pack", numel, [&] {
+#if USE_PADDLE_API
+      torch::FunctionArgs args;
+      args.add_arg(x);
+      DoNotOptimize(args);
+#else
+      torch::jit::Stack stack;
+      stack.emplace_back(x);
+      DoNotOptimize(stack);
+#endif
+    });
+    run_stage("library", "full/call", numel, [&] {
+      auto r = op.call(x);
+      DoNotOptimize(r);
+    });
+  }
+}
+
+}  // namespace test
+}  // namespace at
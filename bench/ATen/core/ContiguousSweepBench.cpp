@@ -0,0 +1,65 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::MakeSweep;
+using paddle_api_test::MakeSweepTensor;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SweepCase;
+using paddle_api_test::SweepCaseName;
+using paddle_api_test::SweepLayoutName;
+using paddle_api_test::SweepSpec;
+
+// benchmark 默认放开到 1e8 元素；大 tensor 单次迭代即达数十毫秒，
+// 只需少量迭代。
+static SweepSpec contiguous_sweep_spec() {
+  SweepSpec spec;
+  spec.ranks = {2, 4};
+  spec.max_numel = SweepSpec::SweepMaxNumel(100000000);
+  return spec;
+}
+
+// contiguous() 在连续输入上应直接返回自身，其余布局需要一次完整拷贝，
+// 吞吐随 dtype / 布局的变化反映拷贝 kernel 是否向量化。
+class ContiguousSweepBench : public ::testing::TestWithParam<SweepCase> {};
+
+TEST_P(ContiguousSweepBench, Contiguous) {
+  const SweepCase& sweep_case = GetParam();
+  at::Tensor input = MakeSweepTensor(sweep_case);
+  BenchmarkResult result = RunBenchmark(
+      "contiguous/" + sweep_case.name(),
+      [&] {
+        at::Tensor out = input.contiguous();
+        DoNotOptimize(out);
+      },
+      OptionsForNumel(sweep_case.numel()));
+  const double bytes = static_cast<double>(sweep_case.numel()) *
+                       c10::elementSize(sweep_case.dtype);
+  result.addCounter("numel", static_cast<double>(sweep_case.numel()));
+  result.addCounter("bytes_per_s", bytes / (result.histogram.mean() * 1e-9));
+  result.addLabel("api", "at::Tensor::contiguous");
+  result.addLabel("dtype", c10::toString(sweep_case.dtype));
+  result.addLabel("layout", SweepLayoutName(sweep_case.layout));
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(Sweep,
+                         ContiguousSweepBench,
+                         ::testing::ValuesIn(MakeSweep(
+                             contiguous_sweep_spec())),
+                         SweepCaseName);
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,123 @@
+#include <ATen/ATen.h>
+#include <ATen/core/ivalue.h>
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+#include <torch/library.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "src/compat_ivalue.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CompatIValue;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+
+// 单次操作只有几纳秒，每次计时迭代内连续执行 kCallsPerIter 次
+constexpr int64_t kCallsPerIter = 100;
+constexpr int64_t kAllocationProbeCalls = 1024;
+
+template <typename Fn>
+static void run_ivalue_op(const std::string& kind,
+                          const std::string& op,
+                          Fn&& fn) {
+  BenchmarkResult result = RunBenchmark("ivalue/" + kind + "/" + op, [&] {
+    for (int64_t i = 0; i < kCallsPerIter; ++i) {
+      auto value = fn();
+      DoNotOptimize(value);
+    }
+  });
+  const AllocationStats allocs = CountAllocations(
+      [&] {
+        auto value = fn();
+        DoNotOptimize(value);
+      },
+      kAllocationProbeCalls);
+  const double allocs_per_op =
+      static_cast<double>(allocs.allocations) / kAllocationProbeCalls;
+  if (op == "construct") {
+    result.addCounter("inline", allocs_per_op == 0.0 ? 1.0 : 0.0);
+  }
+  result.addCounter("calls_per_iter", static_cast<double>(kCallsPerIter));
+  result.addCounter("ns_per_op",
+                    static_cast<double>(result.histogram.percentile(50)) /
+                        kCallsPerIter);
+  result.addCounter("allocs_per_op", allocs_per_op);
+  result.addCounter(
+      "bytes_per_op",
+      static_cast<double>(allocs.bytes) / kAllocationProbeCalls);
+  result.addLabel("api", "IValue");
+  result.addLabel("kind", kind);
+  result.addLabel("op", op);
+  ReportBenchmark(result);
+}
+
+// 对一种取值测量四种操作：
+//   construct 从 C++ 值装箱（值本身按引用传入，拷贝进 IValue）
+//   copy      拷贝构造已装箱的 IValue，堆上的 payload 只增加引用计数
+//   move      移动构造再移动赋值回原对象，一次往返包含两次移动
+//   unbox     to<Unboxed>() 取出 C++ 值
+// construct 的 allocs_per_op 为 0（inline 计数器为 1）即该类型内联存储
+// 在 IValue 中，对应 Torch tagged union 的 payload
+template <typename Unboxed, typename T>
+static void run_ivalue_kind(const std::string& kind, const T& value) {
+  const CompatIValue boxed(value);
+  run_ivalue_op(kind, "construct", [&] { return CompatIValue(value); });
+  run_ivalue_op(kind, "copy", [&] { return CompatIValue(boxed); });
+  CompatIValue source(value);
+  run_ivalue_op(kind, "move", [&] {
+    CompatIValue moved(std::move(source));
+    source = std::move(moved);
+    return 0;
+  });
+  run_ivalue_op(kind, "unbox", [&] { return boxed.template to<Unboxed>(); });
+}
+
+TEST(IValueBench, Scalars) {
+  run_ivalue_kind<int64_t>("int", int64_t{42});
+  run_ivalue_kind<double>("double", 3.5);
+  run_ivalue_kind<bool>("bool", true);
+}
+
+// 短字符串在 std::string 中走 SSO，装箱后是否仍需堆分配取决于 IValue
+// 的字符串表示
+TEST(IValueBench, Strings) {
+  run_ivalue_kind<std::string_view>("string_short", std::string("abc"));
+  run_ivalue_kind<std::string_view>("string_long", std::string(64, 'x'));
+}
+
+TEST(IValueBench, Tensor) {
+  run_ivalue_kind<at::Tensor>("tensor", at::zeros({2, 3}, at::kFloat));
+}
+
+TEST(IValueBench, Containers) {
+  run_ivalue_kind<std::vector<int64_t>>(
+      "int_list", std::vector<int64_t>{1, 2, 3, 4, 5, 6, 7, 8});
+  using Tuple = std::tuple<int64_t, double, std::string>;
+  run_ivalue_kind<Tuple>("tuple", Tuple{7, 2.25, "tuple_v"});
+}
+
+TEST(IValueBench, Optionals) {
+  run_ivalue_kind<std::optional<int64_t>>("optional_some",
+                                          std::optional<int64_t>{33});
+  run_ivalue_kind<std::optional<int64_t>>("optional_none",
+                                          std::optional<int64_t>{});
+}
+
+}  // namespace test
+}  // namespace at
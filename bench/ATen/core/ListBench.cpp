@@ -0,0 +1,225 @@
+#include <ATen/ATen.h>
+#if __has_include(<ATen/core/List.h>)
+#include <ATen/core/List.h>
+#elif __has_include(<c10/core/List.h>)
+#include <c10/core/List.h>
+#endif
+#include <ATen/core/ivalue.h>
+#if !USE_PADDLE_API
+#include <ATen/core/jit_type.h>
+#endif
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "src/compat_ivalue.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CompatIValue;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+
+constexpr int64_t kAllocationProbeCalls = 16;
+
+// 8 个元素对应 boxed kernel 的典型 List<Tensor> 实参，1024 个元素用于
+// 观察逐元素开销
+static std::vector<int64_t> list_sizes() { return {8, 1024}; }
+
+// Torch 的 List<IValue> 没有默认构造（static_assert），必须给出元素类型；
+// 本文件的 IValue 元素都是 int
+template <typename T>
+static c10::List<T> make_list() {
+#if !USE_PADDLE_API
+  if constexpr (std::is_same_v<T, c10::IValue>) {
+    return c10::impl::GenericList(c10::IntType::get());
+  } else {
+    return c10::List<T>();
+  }
+#else
+  return c10::List<T>();
+#endif
+}
+
+// List 结果的 api 标签：被测成员函数的限定名（share 为拷贝构造）。
+// std_vector 结果只是基线，不带 api 标签
+static std::string list_api(const std::string& op) {
+  if (op == "push_back_reserved") {
+    return "c10::List::push_back";
+  }
+  if (op == "indexed_read") {
+    return "c10::List::get";
+  }
+  if (op == "iterate") {
+    return "c10::List::begin";
+  }
+  if (op == "share") {
+    return "c10::List::List";
+  }
+  return "c10::List::" + op;
+}
+
+// 每个操作都与 std::vector<T> 上的同一操作配对，vs_std_vector 为
+// List 与 std::vector 的 p50 之比。Torch 的 c10::List 存储为引用计数的
+// ListImpl，元素以 IValue 保存，读写都要装箱 / 拆箱
+template <typename T>
+class ListOpRunner {
+ public:
+  ListOpRunner(std::string element, int64_t numel)
+      : element_(std::move(element)), numel_(numel) {}
+
+  // 返回 p50，供配对的 List 结果计算 vs_std_vector
+  template <typename Fn>
+  double run(const std::string& op,
+             const std::string& container,
+             double baseline_p50_ns,
+             Fn&& fn) const {
+    BenchmarkResult result = RunBenchmark(
+        "list/" + element_ + "/" + op + "/" + container +
+            "/numel=" + std::to_string(numel_),
+        fn);
+    const AllocationStats allocs = CountAllocations(fn, kAllocationProbeCalls);
+    const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+    result.addCounter("numel", static_cast<double>(numel_));
+    result.addCounter("ns_per_element", p50_ns / numel_);
+    result.addCounter(
+        "allocs_per_call",
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+    if (baseline_p50_ns > 0.0) {
+      result.addCounter("vs_std_vector", p50_ns / baseline_p50_ns);
+    }
+    if (container == "List") {
+      result.addLabel("api", list_api(op));
+    }
+    result.addLabel("container", container);
+    result.addLabel("element", element_);
+    result.addLabel("op", op);
+    ReportBenchmark(result);
+    return p50_ns;
+  }
+
+ private:
+  std::string element_;
+  int64_t numel_;
+};
+
+template <typename T, typename Make>
+static void run_list_suite(const std::string& element, Make&& make) {
+  for (int64_t numel : list_sizes()) {
+    const ListOpRunner<T> runner(element, numel);
+    std::vector<T> values;
+    values.reserve(numel);
+    for (int64_t i = 0; i < numel; ++i) {
+      values.push_back(make(i));
+    }
+
+    // 增长：不预留时按倍增重新分配，预留后只分配一次
+    for (bool reserve : {false, true}) {
+      const std::string op = reserve ? "push_back_reserved" : "push_back";
+      const double vector_ns = runner.run(op, "std_vector", 0.0, [&] {
+        std::vector<T> v;
+        if (reserve) {
+          v.reserve(numel);
+        }
+        for (const T& value : values) {
+          v.push_back(value);
+        }
+        DoNotOptimize(v);
+      });
+      runner.run(op, "List", vector_ns, [&] {
+        c10::List<T> list = make_list<T>();
+        if (reserve) {
+          list.reserve(numel);
+        }
+        for (const T& value : values) {
+          list.push_back(value);
+        }
+        DoNotOptimize(list);
+      });
+    }
+
+    const std::vector<T>& vec = values;
+    c10::List<T> list = make_list<T>();
+    list.reserve(numel);
+    for (const T& value : values) {
+      list.push_back(value);
+    }
+    ASSERT_EQ(static_cast<int64_t>(list.size()), numel);
+
+    // 读取：两边都把元素取成 T 值，List::get 本身按值返回
+    double vector_ns = runner.run("indexed_read", "std_vector", 0.0, [&] {
+      for (size_t i = 0; i < vec.size(); ++i) {
+        T value = vec[i];
+        DoNotOptimize(value);
+      }
+    });
+    runner.run("indexed_read", "List", vector_ns, [&] {
+      for (size_t i = 0; i < list.size(); ++i) {
+        T value = list.get(i);
+        DoNotOptimize(value);
+      }
+    });
+    vector_ns = runner.run("iterate", "std_vector", 0.0, [&] {
+      for (auto it = vec.begin(); it != vec.end(); ++it) {
+        T value = *it;
+        DoNotOptimize(value);
+      }
+    });
+    runner.run("iterate", "List", vector_ns, [&] {
+      for (auto it = list.begin(); it != list.end(); ++it) {
+        T value = *it;
+        DoNotOptimize(value);
+      }
+    });
+
+    // 拷贝：copy() 深拷贝出独立的存储；赋值只共享 ListImpl，
+    // 与元素数无关。两者都与 std::vector 的拷贝构造对比
+    vector_ns = runner.run("copy", "std_vector", 0.0, [&] {
+      std::vector<T> copied = vec;
+      DoNotOptimize(copied);
+    });
+    runner.run("copy", "List", vector_ns, [&] {
+      c10::List<T> copied = list.copy();
+      DoNotOptimize(copied);
+    });
+    runner.run("share", "List", vector_ns, [&] {
+      c10::List<T> shared = list;
+      DoNotOptimize(shared);
+    });
+  }
+}
+
+TEST(ListBench, Int64) {
+  run_list_suite<int64_t>("int64", [](int64_t i) { return i; });
+}
+
+TEST(ListBench, Double) {
+  run_list_suite<double>(
+      "double", [](int64_t i) { return static_cast<double>(i) + 0.5; });
+}
+
+// 所有元素共享同一个 tensor，开销只在引用计数与装箱上
+TEST(ListBench, Tensor) {
+  const at::Tensor t = at::zeros({2, 3}, at::kFloat);
+  run_list_suite<at::Tensor>("tensor", [&](int64_t) { return t; });
+}
+
+TEST(ListBench, IValue) {
+  run_list_suite<CompatIValue>("ivalue",
+                               [](int64_t i) { return CompatIValue(i); });
+}
+
+}  // namespace test
+}  // namespace at
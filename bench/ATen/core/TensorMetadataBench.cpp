@@ -0,0 +1,122 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+
+// 单次访问只有几纳秒，低于计时器分辨率：每次计时迭代内连续调用
+// kCallsPerIter 次，ns_per_call = p50 / kCallsPerIter。DoNotOptimize 的
+// memory clobber 迫使每次调用都重新读取 tensor 元数据，不会被提到循环外。
+constexpr int64_t kCallsPerIter = 1000;
+constexpr int64_t kAllocationProbeCalls = 4096;
+
+// Paddle compat 的 at::Tensor 包装 phi tensor，若访问器每次都要转换
+// DDim / Place / DataType，开销会直接体现在 ns_per_call 上；
+// allocs_per_call 必须为 0，否则说明访问器在堆上构造了临时对象。
+template <typename Fn>
+static void run_accessor(const std::string& api,
+                         const std::string& variant,
+                         const std::string& input_name,
+                         Fn&& fn) {
+  const std::string accessor = variant.empty() ? api : api + "/" + variant;
+  BenchmarkResult result =
+      RunBenchmark("metadata/" + accessor + "/" + input_name, [&] {
+        for (int64_t i = 0; i < kCallsPerIter; ++i) {
+          auto value = fn();
+          DoNotOptimize(value);
+        }
+      });
+  const AllocationStats allocs = CountAllocations(
+      [&] {
+        auto value = fn();
+        DoNotOptimize(value);
+      },
+      kAllocationProbeCalls);
+  const double allocs_per_call =
+      static_cast<double>(allocs.allocations) / kAllocationProbeCalls;
+  result.addCounter("calls_per_iter", static_cast<double>(kCallsPerIter));
+  result.addCounter("ns_per_call",
+                    static_cast<double>(result.histogram.percentile(50)) /
+                        kCallsPerIter);
+  result.addCounter("allocs_per_call", allocs_per_call);
+  result.addLabel("api", api);
+  result.addLabel("input", input_name);
+  ReportBenchmark(result);
+  EXPECT_EQ(allocs.allocations, 0)
+      << accessor << " on " << input_name << " allocated "
+      << allocs.allocations << " times in " << kAllocationProbeCalls
+      << " calls";
+}
+
+// 三种输入覆盖访问器可能走的不同分支：连续、转置（步长非递减顺序，
+// is_contiguous 为 false）、切片（storage_offset 非 0）
+class TensorMetadataBench : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    at::Tensor base = at::empty({8, 16, 32}, at::kFloat);
+    inputs_ = {{"contiguous", base},
+               {"transposed", base.transpose(0, 2)},
+               {"sliced", base.slice(1, 2, 10)}};
+  }
+
+  std::vector<std::pair<std::string, at::Tensor>> inputs_;
+};
+
+TEST_F(TensorMetadataBench, Shape) {
+  for (const auto& [name, x] : inputs_) {
+    run_accessor("dim", "", name, [&] { return x.dim(); });
+    run_accessor("numel", "", name, [&] { return x.numel(); });
+    run_accessor("sizes", "", name, [&] { return x.sizes(); });
+    run_accessor("strides", "", name, [&] { return x.strides(); });
+    run_accessor("size", "1", name, [&] { return x.size(1); });
+    run_accessor("size", "-1", name, [&] { return x.size(-1); });
+    run_accessor("stride", "1", name, [&] { return x.stride(1); });
+    run_accessor("stride", "-1", name, [&] { return x.stride(-1); });
+    run_accessor("is_contiguous", "", name, [&] { return x.is_contiguous(); });
+    run_accessor(
+        "storage_offset", "", name, [&] { return x.storage_offset(); });
+  }
+}
+
+TEST_F(TensorMetadataBench, SymShape) {
+  for (const auto& [name, x] : inputs_) {
+    run_accessor("sym_size", "1", name, [&] { return x.sym_size(1); });
+    run_accessor("sym_stride", "1", name, [&] { return x.sym_stride(1); });
+    run_accessor("sym_sizes", "", name, [&] { return x.sym_sizes(); });
+    run_accessor("sym_strides", "", name, [&] { return x.sym_strides(); });
+  }
+}
+
+TEST_F(TensorMetadataBench, DataPtr) {
+  for (const auto& [name, x] : inputs_) {
+    run_accessor(
+        "data_ptr", "float", name, [&] { return x.data_ptr<float>(); });
+    run_accessor("data_ptr", "void", name, [&] { return x.data_ptr(); });
+  }
+}
+
+TEST_F(TensorMetadataBench, TypeAndDevice) {
+  for (const auto& [name, x] : inputs_) {
+    run_accessor("scalar_type", "", name, [&] { return x.scalar_type(); });
+    run_accessor("device", "", name, [&] { return x.device(); });
+    run_accessor("layout", "", name, [&] { return x.layout(); });
+  }
+}
+
+}  // namespace test
+}  // namespace at
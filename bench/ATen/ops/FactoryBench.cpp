@@ -0,0 +1,308 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/arange.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/empty_like.h>
+#include <ATen/ops/empty_strided.h>
+#include <ATen/ops/eye.h>
+#include <ATen/ops/full.h>
+#include <ATen/ops/new_empty.h>
+#include <ATen/ops/new_full.h>
+#include <ATen/ops/new_ones.h>
+#include <ATen/ops/new_zeros.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/tensor.h>
+#include <ATen/ops/zeros.h>
+#include <ATen/ops/zeros_like.h>
+#include <gtest/gtest.h>
+#include <sys/resource.h>
+
+#include <cmath>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::ShapeForNumel;
+using paddle_api_test::SweepNumels;
+
+// 每个规模预先构造的输入：_like / new_* 的源 tensor、at::tensor 的
+// host 数据、empty_strided 的列主序 shape 与 stride
+struct FactoryInputs {
+  int64_t numel = 0;
+  std::vector<int64_t> shape;  // {numel}
+  std::vector<c10::SymInt> sym_shape;
+  std::vector<int64_t> matrix_shape;  // ShapeForNumel(numel, 2)
+  std::vector<int64_t> column_major_strides;
+  int64_t eye_n = 0;  // eye(n) 的元素数不超过 numel
+  at::Tensor like_source;
+  at::Tensor small_source;
+  std::vector<float> host_data;
+};
+
+// fills 为 false 的算子只分配不写数据，其 p50 即分配延迟；其余算子
+// 额外写满输出，fill_bytes_per_s 扣除同规模 empty 的分配延迟后计算
+struct FactoryOp {
+  const char* name;
+  bool fills;
+  std::function<at::Tensor(const FactoryInputs&)> run;
+};
+
+static const at::TensorOptions& float_options() {
+  static const at::TensorOptions options =
+      at::TensorOptions().dtype(at::kFloat);
+  return options;
+}
+
+static const std::vector<FactoryOp>& factory_ops() {
+  static const std::vector<FactoryOp> ops = {
+      {"empty",
+       false,
+       [](const FactoryInputs& in) {
+         return at::empty(in.shape, float_options());
+       }},
+      {"empty_strided",
+       false,
+       [](const FactoryInputs& in) {
+         return at::empty_strided(
+             in.matrix_shape, in.column_major_strides, float_options());
+       }},
+      {"empty_like",
+       false,
+       [](const FactoryInputs& in) { return at::empty_like(in.like_source); }},
+      {"new_empty",
+       false,
+       [](const FactoryInputs& in) {
+         return in.small_source.new_empty(in.shape);
+       }},
+      {"zeros",
+       true,
+       [](const FactoryInputs& in) {
+         return at::zeros(in.shape, float_options());
+       }},
+      {"ones",
+       true,
+       [](const FactoryInputs& in) {
+         return at::ones(in.shape, float_options());
+       }},
+      {"full",
+       true,
+       [](const FactoryInputs& in) {
+         return at::full(in.shape, 1.5, float_options());
+       }},
+      {"zeros_symint",
+       true,
+       [](const FactoryInputs& in) {
+         return at::zeros_symint(in.sym_shape, float_options());
+       }},
+      {"ones_symint",
+       true,
+       [](const FactoryInputs& in) {
+         return at::ones_symint(in.sym_shape, float_options());
+       }},
+      {"full_symint",
+       true,
+       [](const FactoryInputs& in) {
+         return at::full_symint(in.sym_shape, 1.5, float_options());
+       }},
+      {"zeros_like",
+       true,
+       [](const FactoryInputs& in) { return at::zeros_like(in.like_source); }},
+      {"new_zeros",
+       true,
+       [](const FactoryInputs& in) {
+         return in.small_source.new_zeros(in.shape);
+       }},
+      {"new_ones",
+       true,
+       [](const FactoryInputs& in) {
+         return in.small_source.new_ones(in.shape);
+       }},
+      {"new_full",
+       true,
+       [](const FactoryInputs& in) {
+         return in.small_source.new_full(in.shape, 1.5);
+       }},
+      {"arange",
+       true,
+       [](const FactoryInputs& in) {
+         return at::arange(in.numel, float_options());
+       }},
+      {"eye",
+       true,
+       [](const FactoryInputs& in) {
+         return at::eye(in.eye_n, float_options());
+       }},
+      // at::tensor 从 host 数组拷贝，吞吐即拷贝带宽
+      {"tensor",
+       true,
+       [](const FactoryInputs& in) {
+         return at::tensor(at::ArrayRef<float>(in.host_data), float_options());
+       }},
+  };
+  return ops;
+}
+
+// 1 个元素到 1e8 个 float（400MB）；与 ContiguousSweepBench 一样可由
+// PADDLE_API_SWEEP_MAX_NUMEL 收窄
+static std::vector<int64_t> factory_numels() {
+  return SweepNumels({1, 1000, 100000, 1000000, 10000000, 100000000},
+                     100000000);
+}
+
+// 源 tensor 与 host 数据只为需要它们的算子构造，避免 1e8 规模下
+// 每个用例都额外占用数百 MB
+static FactoryInputs make_inputs(const FactoryOp& op, int64_t numel) {
+  const std::string name = op.name;
+  FactoryInputs in;
+  in.numel = numel;
+  in.shape = {numel};
+  in.sym_shape = {c10::SymInt(numel)};
+  in.matrix_shape = ShapeForNumel(numel, 2);
+  in.column_major_strides = {1, in.matrix_shape[0]};
+  in.eye_n = static_cast<int64_t>(std::sqrt(static_cast<double>(numel)));
+  in.small_source = at::empty({1}, float_options());
+  if (name.find("_like") != std::string::npos) {
+    in.like_source = at::empty(in.shape, float_options());
+  }
+  if (name == "tensor") {
+    in.host_data.assign(numel, 1.0f);
+  }
+  return in;
+}
+
+// 连续创建并立即释放 iters 个 tensor：distinct_ptrs 为出现过的不同数据
+// 指针数，1 表示每次都复用同一块内存；minor_faults_per_iter 接近
+// bytes / 页大小时说明每次都拿到新映射的页（如大块 malloc 走 mmap），
+// 首次写入的缺页开销计入了 fill 延迟
+struct RecycleStats {
+  int64_t iters = 0;
+  int64_t distinct_ptrs = 0;
+  double minor_faults_per_iter = 0.0;
+};
+
+// 按进程统计：大 tensor 的填充由 intra-op 线程池完成，缺页发生在工作线程
+static int64_t process_minor_faults() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_minflt;
+}
+
+static RecycleStats measure_recycling(const FactoryOp& op,
+                                      const FactoryInputs& in,
+                                      int64_t iters) {
+  std::set<const void*> ptrs;
+  const int64_t faults_begin = process_minor_faults();
+  for (int64_t i = 0; i < iters; ++i) {
+    at::Tensor r = op.run(in);
+    ptrs.insert(r.data_ptr());
+  }
+  RecycleStats stats;
+  stats.iters = iters;
+  stats.distinct_ptrs = static_cast<int64_t>(ptrs.size());
+  stats.minor_faults_per_iter =
+      static_cast<double>(process_minor_faults() - faults_begin) / iters;
+  return stats;
+}
+
+struct FactoryCase {
+  size_t op_index;
+  int64_t numel;
+};
+
+static std::vector<FactoryCase> factory_cases() {
+  std::vector<FactoryCase> cases;
+  for (size_t i = 0; i < factory_ops().size(); ++i) {
+    for (int64_t numel : factory_numels()) {
+      cases.push_back({i, numel});
+    }
+  }
+  return cases;
+}
+
+class FactoryBench : public ::testing::TestWithParam<FactoryCase> {
+ protected:
+  // 同规模 empty 的 p50，作为 fill 类算子的分配成本基线
+  static double empty_p50_ns(const FactoryInputs& in) {
+    static std::map<int64_t, double> cache;
+    auto it = cache.find(in.numel);
+    if (it == cache.end()) {
+      BenchmarkResult result = RunBenchmark(
+          "empty_baseline",
+          [&] {
+            at::Tensor r = factory_ops()[0].run(in);
+            DoNotOptimize(r);
+          },
+          OptionsForNumel(in.numel));
+      it = cache
+               .emplace(in.numel,
+                        static_cast<double>(result.histogram.percentile(50)))
+               .first;
+    }
+    return it->second;
+  }
+};
+
+TEST_P(FactoryBench, Throughput) {
+  const FactoryOp& op = factory_ops()[GetParam().op_index];
+  const FactoryInputs in = make_inputs(op, GetParam().numel);
+
+  at::Tensor sample = op.run(in);
+  const double bytes = static_cast<double>(sample.numel()) * sizeof(float);
+  sample = at::Tensor();
+
+  BenchmarkResult result = RunBenchmark(
+      std::string(op.name) + "/numel=" + std::to_string(in.numel),
+      [&] {
+        at::Tensor r = op.run(in);
+        DoNotOptimize(r);
+      },
+      OptionsForNumel(in.numel));
+  const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+  result.addCounter("numel", static_cast<double>(in.numel));
+  result.addCounter("bytes", bytes);
+  if (op.fills) {
+    const double alloc_ns = empty_p50_ns(in);
+    result.addCounter("alloc_ns", alloc_ns);
+    result.addCounter("bytes_per_s", bytes / (p50_ns * 1e-9));
+    if (p50_ns > alloc_ns) {
+      result.addCounter("fill_bytes_per_s",
+                        bytes / ((p50_ns - alloc_ns) * 1e-9));
+    }
+  } else {
+    result.addCounter("alloc_ns", p50_ns);
+  }
+
+  const RecycleStats recycle =
+      measure_recycling(op, in, in.numel >= 10000000 ? 8 : 64);
+  result.addCounter("recycle_iters", static_cast<double>(recycle.iters));
+  result.addCounter("distinct_ptrs",
+                    static_cast<double>(recycle.distinct_ptrs));
+  result.addCounter("minor_faults_per_iter", recycle.minor_faults_per_iter);
+  result.addLabel("api", op.name);
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Factories,
+    FactoryBench,
+    ::testing::ValuesIn(factory_cases()),
+    [](const ::testing::TestParamInfo<FactoryCase>& info) {
+      return std::string(factory_ops()[info.param.op_index].name) + "_" +
+             std::to_string(info.param.numel);
+    });
+
+}  // namespace test
+}  // namespace at
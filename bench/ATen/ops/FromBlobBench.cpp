@@ -0,0 +1,241 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/from_blob.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::ShapeForNumel;
+using paddle_api_test::SweepNumels;
+using paddle_api_test::kConstantTimeMaxGrowth;
+using paddle_api_test::kConstantTimeSlackNs;
+
+// from_blob 只包装外部指针，包装 + 释放的耗时应与缓冲区大小无关，
+// 超出 kConstantTimeMaxGrowth 阈值即判定为隐式拷贝或逐元素初始化
+constexpr int64_t kAllocationProbeCalls = 1024;
+
+// 外部缓冲区及其一维 / 二维（列主序）描述
+struct BlobInputs {
+  float* data = nullptr;
+  int64_t numel = 0;
+  std::vector<int64_t> shape;  // {numel}
+  std::vector<int64_t> matrix_shape;
+  std::vector<int64_t> column_major_strides;
+  std::atomic<int64_t>* deleter_calls = nullptr;
+};
+
+struct FromBlobVariant {
+  const char* name;
+  std::function<at::Tensor(const BlobInputs&)> wrap;
+};
+
+static const std::vector<FromBlobVariant>& from_blob_variants() {
+  static const std::vector<FromBlobVariant> variants = {
+      {"plain",
+       [](const BlobInputs& in) { return at::from_blob(in.data, in.shape); }},
+      {"options",
+       [](const BlobInputs& in) {
+         return at::from_blob(
+             in.data, in.shape, at::TensorOptions().dtype(at::kFloat));
+       }},
+      {"strides",
+       [](const BlobInputs& in) {
+         return at::from_blob(in.data,
+                              in.matrix_shape,
+                              in.column_major_strides,
+                              at::TensorOptions().dtype(at::kFloat));
+       }},
+      // 无捕获的 deleter：std::function 不需要堆分配
+      {"deleter",
+       [](const BlobInputs& in) {
+         return at::from_blob(
+             in.data,
+             in.shape,
+             [](void*) {},
+             at::TensorOptions().dtype(at::kFloat));
+       }},
+      // 捕获上下文指针的 deleter，对应把网络缓冲区归还给连接池的场景
+      {"deleter_ctx",
+       [](const BlobInputs& in) {
+         std::atomic<int64_t>* calls = in.deleter_calls;
+         return at::from_blob(
+             in.data,
+             in.shape,
+             [calls](void*) { calls->fetch_add(1, std::memory_order_relaxed); },
+             at::TensorOptions().dtype(at::kFloat));
+       }},
+      {"strides_deleter",
+       [](const BlobInputs& in) {
+         return at::from_blob(
+             in.data,
+             in.matrix_shape,
+             in.column_major_strides,
+             [](void*) {},
+             at::TensorOptions().dtype(at::kFloat));
+       }},
+  };
+  return variants;
+}
+
+// 1 个元素到 1e8 个 float；缓冲区由调用方持有，只分配一次
+static std::vector<int64_t> blob_numels() {
+  return SweepNumels({1, 1000, 1000000, 100000000}, 100000000);
+}
+
+class FromBlobBench : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(FromBlobBench, Wrap) {
+  const FromBlobVariant& variant = from_blob_variants()[GetParam()];
+  const std::vector<int64_t> numels = blob_numels();
+  std::unique_ptr<float[]> buffer(new float[numels.back()]);
+  std::atomic<int64_t> deleter_calls{0};
+
+  std::vector<double> p50s;
+  for (int64_t numel : numels) {
+    BlobInputs in;
+    in.data = buffer.get();
+    in.numel = numel;
+    in.shape = {numel};
+    in.matrix_shape = ShapeForNumel(numel, 2);
+    in.column_major_strides = {1, in.matrix_shape[0]};
+    in.deleter_calls = &deleter_calls;
+
+    BenchmarkResult result = RunBenchmark(
+        std::string("from_blob/") + variant.name + "/numel=" +
+            std::to_string(numel),
+        [&] {
+          at::Tensor t = variant.wrap(in);
+          DoNotOptimize(t);
+        });
+    deleter_calls.store(0);
+    const AllocationStats allocs = CountAllocations(
+        [&] {
+          at::Tensor t = variant.wrap(in);
+          DoNotOptimize(t);
+        },
+        kAllocationProbeCalls);
+    const at::Tensor sample = variant.wrap(in);
+    EXPECT_EQ(sample.data_ptr(), static_cast<void*>(in.data));
+
+    result.addCounter("numel", static_cast<double>(numel));
+    result.addCounter(
+        "allocs_per_wrap",
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+    result.addCounter(
+        "bytes_allocated_per_wrap",
+        static_cast<double>(allocs.bytes) / kAllocationProbeCalls);
+    if (std::string(variant.name) == "deleter_ctx") {
+      result.addCounter("deleter_calls_per_wrap",
+                        static_cast<double>(deleter_calls.load()) /
+                            kAllocationProbeCalls);
+    }
+    result.addLabel("api", "from_blob");
+    result.addLabel("variant", variant.name);
+    ReportBenchmark(result);
+    p50s.push_back(static_cast<double>(result.histogram.percentile(50)));
+  }
+  EXPECT_LE(p50s.back(),
+            kConstantTimeMaxGrowth * p50s.front() + kConstantTimeSlackNs)
+      << variant.name << " wrap latency grows with buffer size";
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Variants,
+    FromBlobBench,
+    ::testing::Range<size_t>(0, from_blob_variants().size()),
+    [](const ::testing::TestParamInfo<size_t>& info) {
+      return std::string(from_blob_variants()[info.param].name);
+    });
+
+// deleter 必须在最后一个引用（含视图）释放时同步调用，且只调用一次。
+// release_to_deleter_ns 为最后一次 reset 开始到 deleter 执行的间隔，
+// last_release_ns 为带 deleter 的最后一次释放的总耗时
+TEST(FromBlobDeleterBench, Timing) {
+  using Clock = std::chrono::steady_clock;
+  constexpr int kRounds = 1000;
+  std::vector<float> buffer(1024);
+  struct DeleterState {
+    int64_t calls = 0;
+    Clock::time_point called_at;
+  } state;
+
+  int64_t early_calls = 0;
+  int64_t late_calls = 0;
+  std::vector<double> release_to_deleter;
+  std::vector<double> last_release;
+  for (int round = 0; round < kRounds; ++round) {
+    state.calls = 0;
+    at::Tensor t = at::from_blob(
+        buffer.data(),
+        {static_cast<int64_t>(buffer.size())},
+        [&state](void*) {
+          state.called_at = Clock::now();
+          ++state.calls;
+        },
+        at::TensorOptions().dtype(at::kFloat));
+    at::Tensor copy = t;
+    at::Tensor view = t.slice(0, 1, 512);
+    t = at::Tensor();
+    copy = at::Tensor();
+    early_calls += state.calls;
+
+    const auto begin = Clock::now();
+    view = at::Tensor();
+    const auto end = Clock::now();
+    if (state.calls != 1) {
+      ++late_calls;
+      continue;
+    }
+    release_to_deleter.push_back(static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(state.called_at -
+                                                             begin)
+            .count()));
+    last_release.push_back(static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count()));
+  }
+  EXPECT_EQ(early_calls, 0) << "deleter ran before the last reference died";
+  EXPECT_EQ(late_calls, 0) << "deleter did not run on the last release";
+
+  BenchmarkResult result("from_blob/deleter_timing");
+  for (double value : last_release) {
+    result.histogram.record(static_cast<int64_t>(value));
+  }
+  result.iterations = result.histogram.count();
+  result.total_ns = result.histogram.mean() * result.iterations;
+  double delay_sum = 0.0;
+  for (double value : release_to_deleter) {
+    delay_sum += value;
+  }
+  result.addCounter("rounds", kRounds);
+  result.addCounter("early_calls", static_cast<double>(early_calls));
+  result.addCounter("late_calls", static_cast<double>(late_calls));
+  result.addCounter("release_to_deleter_ns",
+                    release_to_deleter.empty()
+                        ? 0.0
+                        : delay_sum / release_to_deleter.size());
+  result.addLabel("api", "from_blob");
+  result.addLabel("variant", "deleter_timing");
+  ReportBenchmark(result);
+}
+
+}  // namespace test
+}  // namespace at
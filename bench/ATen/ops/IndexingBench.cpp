@@ -0,0 +1,270 @@
+#include <ATen/ATen.h>
+#include <ATen/TensorIndexing.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using at::indexing::Ellipsis;
+using at::indexing::None;
+using at::indexing::Slice;
+using at::indexing::TensorIndex;
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SweepNumels;
+
+constexpr int64_t kAllocationProbeCalls = 1024;
+// 与 1e3 ~ 1e7 的规模都互素，(i * kPermutationStride) % n 是一个打散的
+// 排列，用作无重复的 index_put 目标
+constexpr int64_t kPermutationStride = 1000003;
+// 有重复的 index_put 中目标位置数为 numel / kDuplicateFactor
+constexpr int64_t kDuplicateFactor = 16;
+
+// 构造 TensorIndex 只有几纳秒，每次计时迭代内连续执行 calls_per_iter
+// 次；allocs_per_call 为 operator new 次数，Torch 的 Slice / 整数索引
+// 以 SymInt 内联存储，不需要堆分配
+template <typename Fn>
+static void run_index_expression(const std::string& api,
+                                 const std::string& variant,
+                                 int64_t calls_per_iter,
+                                 Fn&& fn) {
+  BenchmarkResult result =
+      RunBenchmark("indexing/" + api + "/" + variant, [&] {
+        for (int64_t i = 0; i < calls_per_iter; ++i) {
+          auto value = fn();
+          DoNotOptimize(value);
+        }
+      });
+  const AllocationStats allocs = CountAllocations(
+      [&] {
+        auto value = fn();
+        DoNotOptimize(value);
+      },
+      kAllocationProbeCalls);
+  result.addCounter("calls_per_iter", static_cast<double>(calls_per_iter));
+  result.addCounter("ns_per_call",
+                    static_cast<double>(result.histogram.percentile(50)) /
+                        calls_per_iter);
+  result.addCounter(
+      "allocs_per_call",
+      static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+  result.addLabel("api", api);
+  result.addLabel("variant", variant);
+  ReportBenchmark(result);
+}
+
+// 只构造索引对象，不接触任何 tensor 数据
+TEST(IndexingParseBench, TensorIndexConstruction) {
+  const at::Tensor index_tensor = at::zeros({4}, at::kLong);
+  constexpr int64_t kCalls = 1000;
+  run_index_expression(
+      "TensorIndex", "none", kCalls, [] { return TensorIndex(None); });
+  run_index_expression(
+      "TensorIndex", "ellipsis", kCalls, [] { return TensorIndex(Ellipsis); });
+  run_index_expression("TensorIndex", "ellipsis_string", kCalls, [] {
+    return TensorIndex("...");
+  });
+  run_index_expression("TensorIndex", "integer", kCalls, [] {
+    return TensorIndex(static_cast<int64_t>(5));
+  });
+  run_index_expression(
+      "TensorIndex", "boolean", kCalls, [] { return TensorIndex(true); });
+  run_index_expression("TensorIndex", "slice", kCalls, [] {
+    return TensorIndex(Slice(1, 10, 2));
+  });
+  run_index_expression("TensorIndex", "tensor", kCalls, [&] {
+    return TensorIndex(index_tensor);
+  });
+}
+
+// 只含 Slice / None / Ellipsis / 整数 / 布尔的表达式结果都是视图，
+// 耗时即索引表达式的解析与视图构造开销，与元素数无关
+TEST(IndexingParseBench, ViewExpressions) {
+  const at::Tensor x = at::zeros({64, 64, 64}, at::kFloat);
+  constexpr int64_t kCalls = 100;
+  const auto run_view = [&](const std::string& variant, auto&& fn) {
+    const at::Tensor r = fn();
+    EXPECT_TRUE(r.is_alias_of(x)) << variant << " copied data";
+    run_index_expression("index", variant, kCalls, fn);
+  };
+  run_view("slice", [&] { return x.index({Slice(1, 63)}); });
+  run_view("slice3", [&] {
+    return x.index({Slice(), Slice(0, 32), Slice(0, 64, 2)});
+  });
+  run_view("integer", [&] { return x.index({1, Slice()}); });
+  run_view("none_ellipsis",
+           [&] { return x.index({None, Ellipsis, Slice(0, 2)}); });
+  run_view("boolean", [&] { return x.index({true}); });
+}
+
+// 1e3 到 1e7 个索引
+static std::vector<int64_t> index_numels() {
+  return SweepNumels({1000, 10000, 100000, 1000000, 10000000}, 10000000);
+}
+
+// range 内的伪随机 int64 索引
+static at::Tensor random_indices(int64_t numel, int64_t range) {
+  at::Tensor indices = at::empty({numel}, at::kLong);
+  int64_t* data = indices.data_ptr<int64_t>();
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (int64_t i = 0; i < numel; ++i) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    data[i] = static_cast<int64_t>((state >> 33) % range);
+  }
+  return indices;
+}
+
+static at::Tensor permuted_indices(int64_t numel) {
+  at::Tensor indices = at::empty({numel}, at::kLong);
+  int64_t* data = indices.data_ptr<int64_t>();
+  for (int64_t i = 0; i < numel; ++i) {
+    data[i] = (i * kPermutationStride) % numel;
+  }
+  return indices;
+}
+
+class IndexGatherBench : public ::testing::TestWithParam<int64_t> {};
+
+// x.index({indices})：从 numel 个 float 中按随机索引取 numel 个。
+// 同一输入上单元素索引的 p50 记为 fixed_ns（表达式解析与输出分配等
+// 固定开销），其余部分摊到每个索引上
+TEST_P(IndexGatherBench, TensorIndex) {
+  const int64_t numel = GetParam();
+  const at::Tensor x = at::ones({numel}, at::kFloat);
+  const at::Tensor indices = random_indices(numel, numel);
+  const at::Tensor single = random_indices(1, numel);
+
+  BenchmarkResult fixed = RunBenchmark("index_fixed", [&] {
+    at::Tensor r = x.index({single});
+    DoNotOptimize(r);
+  });
+  BenchmarkResult result = RunBenchmark(
+      "index/tensor/numel=" + std::to_string(numel),
+      [&] {
+        at::Tensor r = x.index({indices});
+        DoNotOptimize(r);
+      },
+      OptionsForNumel(numel));
+  const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+  const double fixed_ns = static_cast<double>(fixed.histogram.percentile(50));
+  result.addCounter("numel", static_cast<double>(numel));
+  result.addCounter("elements_per_s", numel / (p50_ns * 1e-9));
+  result.addCounter("fixed_ns", fixed_ns);
+  result.addCounter("ns_per_index", std::max(0.0, p50_ns - fixed_ns) / numel);
+  result.addLabel("api", "index");
+  ReportBenchmark(result);
+
+  const at::Tensor out = x.index({indices});
+  EXPECT_EQ(out.numel(), numel);
+}
+
+INSTANTIATE_TEST_SUITE_P(Sizes,
+                         IndexGatherBench,
+                         ::testing::ValuesIn(index_numels()),
+                         [](const ::testing::TestParamInfo<int64_t>& info) {
+                           return std::to_string(info.param);
+                         });
+
+struct IndexPutCase {
+  int64_t numel;
+  bool accumulate;
+  bool duplicates;
+
+  std::string name() const {
+    return std::string(accumulate ? "accumulate" : "assign") +
+           (duplicates ? "_duplicates_" : "_unique_") + std::to_string(numel);
+  }
+};
+
+static std::vector<IndexPutCase> index_put_cases() {
+  std::vector<IndexPutCase> cases;
+  for (bool accumulate : {false, true}) {
+    for (bool duplicates : {false, true}) {
+      for (int64_t numel : index_numels()) {
+        cases.push_back({numel, accumulate, duplicates});
+      }
+    }
+  }
+  return cases;
+}
+
+class IndexPutBench : public ::testing::TestWithParam<IndexPutCase> {};
+
+// dst.index_put_({indices}, values, accumulate)，dst 与 indices 均为
+// numel 个元素。duplicates 时目标只有 numel / 16 个位置，accumulate
+// 需要对同一位置串行累加（或原子加），assign 则任取其一
+TEST_P(IndexPutBench, Scatter) {
+  const IndexPutCase& c = GetParam();
+  const int64_t range =
+      c.duplicates ? std::max<int64_t>(1, c.numel / kDuplicateFactor)
+                   : c.numel;
+  at::Tensor dst = at::zeros({c.numel}, at::kFloat);
+  const at::Tensor values = at::ones({c.numel}, at::kFloat);
+  const at::Tensor index_tensor = c.duplicates
+                                      ? random_indices(c.numel, range)
+                                      : permuted_indices(c.numel);
+  c10::List<std::optional<at::Tensor>> indices;
+  indices.push_back(index_tensor);
+
+  BenchmarkResult result = RunBenchmark(
+      "index_put_/" + c.name(),
+      [&] {
+        at::Tensor& r = dst.index_put_(indices, values, c.accumulate);
+        DoNotOptimize(r);
+      },
+      OptionsForNumel(c.numel));
+  const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+
+  // 所有 values 都是 1：accumulate 后总和为 numel，assign 后为被写到的
+  // 不同位置数，与重复位置上取哪个值无关
+  const int64_t* index_data = index_tensor.data_ptr<int64_t>();
+  std::vector<bool> touched(c.numel, false);
+  int64_t distinct = 0;
+  for (int64_t i = 0; i < c.numel; ++i) {
+    if (!touched[index_data[i]]) {
+      touched[index_data[i]] = true;
+      ++distinct;
+    }
+  }
+  dst.zero_();
+  dst.index_put_(indices, values, c.accumulate);
+  const double expected =
+      static_cast<double>(c.accumulate ? c.numel : distinct);
+  EXPECT_EQ(dst.sum().item<float>(), expected) << c.name();
+
+  result.addCounter("numel", static_cast<double>(c.numel));
+  result.addCounter("distinct_targets", static_cast<double>(distinct));
+  result.addCounter("elements_per_s", c.numel / (p50_ns * 1e-9));
+  result.addLabel("api", "index_put_");
+  result.addLabel("accumulate", c.accumulate ? "true" : "false");
+  result.addLabel("indices", c.duplicates ? "duplicates" : "unique");
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Sizes,
+    IndexPutBench,
+    ::testing::ValuesIn(index_put_cases()),
+    [](const ::testing::TestParamInfo<IndexPutCase>& info) {
+      return info.param.name();
+    });
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,386 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/std.h>
+#include <ATen/ops/sum.h>
+#include <c10/util/BFloat16.h>
+#include <c10/util/Half.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::ShapeForNumel;
+using paddle_api_test::SweepLayout;
+using paddle_api_test::SweepLayoutName;
+using paddle_api_test::SweepNumels;
+
+enum class ReduceOp { kSum, kStd, kVar, kAll, kAllClose };
+
+// dim 为 -1 表示全量归约；输入均为 rank 2，dim 取 0 或 1
+struct ReduceMode {
+  int64_t dim;
+  bool keepdim;
+};
+
+struct ReductionCase {
+  ReduceOp op;
+  ReduceMode mode;
+  at::ScalarType dtype;
+  int64_t numel;
+  SweepLayout layout;
+
+  std::string name() const;
+};
+
+static const char* reduce_op_name(ReduceOp op) {
+  switch (op) {
+    case ReduceOp::kSum:
+      return "sum";
+    case ReduceOp::kStd:
+      return "std";
+    case ReduceOp::kVar:
+      return "var";
+    case ReduceOp::kAll:
+      return "all";
+    case ReduceOp::kAllClose:
+      return "allclose";
+  }
+  return "unknown";
+}
+
+static std::string mode_name(const ReduceMode& mode) {
+  if (mode.dim < 0) {
+    return "full";
+  }
+  return "dim" + std::to_string(mode.dim) + (mode.keepdim ? "_keepdim" : "");
+}
+
+std::string ReductionCase::name() const {
+  return std::string(reduce_op_name(op)) + "_" + mode_name(mode) + "_" +
+         c10::toString(dtype) + "_" + std::to_string(numel) + "_" +
+         SweepLayoutName(layout);
+}
+
+// 默认到 1e8 元素；PADDLE_API_SWEEP_MAX_NUMEL=1000000000 放开到 1e9
+// （float 输入 4GB，Long 输入 8GB）
+static std::vector<int64_t> reduction_numels() {
+  return SweepNumels({10000, 1000000, 100000000, 1000000000}, 100000000);
+}
+
+// 按 numel -> layout -> dtype 的顺序展开，相邻 case 共享同一份输入
+static std::vector<ReductionCase> reduction_cases() {
+  const ReduceMode full = {-1, false};
+  const ReduceMode dim0 = {0, false};
+  const ReduceMode dim1 = {1, false};
+  const ReduceMode dim1_keepdim = {1, true};
+  struct OpSpec {
+    ReduceOp op;
+    std::vector<ReduceMode> modes;
+    std::vector<at::ScalarType> dtypes;
+  };
+  const std::vector<OpSpec> ops = {
+      // Half / BFloat16 / Float 检验 float 累加，Int 检验提升到 int64
+      {ReduceOp::kSum,
+       {full, dim0, dim1, dim1_keepdim},
+       {at::kFloat,
+        at::kDouble,
+        at::kHalf,
+        at::kBFloat16,
+        at::kInt,
+        at::kLong}},
+      {ReduceOp::kStd,
+       {full, dim0, dim1, dim1_keepdim},
+       {at::kFloat, at::kDouble}},
+      {ReduceOp::kVar, {full, dim1}, {at::kFloat, at::kDouble}},
+      {ReduceOp::kAll, {full, dim1}, {at::kBool}},
+      {ReduceOp::kAllClose, {full}, {at::kFloat, at::kDouble}},
+  };
+  const std::vector<at::ScalarType> dtypes = {at::kFloat,
+                                              at::kDouble,
+                                              at::kHalf,
+                                              at::kBFloat16,
+                                              at::kInt,
+                                              at::kLong,
+                                              at::kBool};
+  std::vector<ReductionCase> cases;
+  for (int64_t numel : reduction_numels()) {
+    for (SweepLayout layout :
+         {SweepLayout::kContiguous, SweepLayout::kTransposed}) {
+      for (at::ScalarType dtype : dtypes) {
+        for (const OpSpec& spec : ops) {
+          if (std::find(spec.dtypes.begin(), spec.dtypes.end(), dtype) ==
+              spec.dtypes.end()) {
+            continue;
+          }
+          for (const ReduceMode& mode : spec.modes) {
+            cases.push_back({spec.op, mode, dtype, numel, layout});
+          }
+        }
+      }
+    }
+  }
+  return cases;
+}
+
+// 浮点输入为 [0, 1) 均匀分布，整数输入为 0..6，bool 输入全为 true
+// （all 必须扫描全部元素）。先按存储 shape 生成连续的 float 数据并转换
+// dtype，再转置得到 transposed 布局，不依赖 to() 是否保留 stride
+static at::Tensor make_reduction_input(at::ScalarType dtype,
+                                       int64_t numel,
+                                       SweepLayout layout) {
+  const std::vector<int64_t> shape = ShapeForNumel(numel, 2);
+  const bool transposed = layout == SweepLayout::kTransposed;
+  const std::vector<int64_t> storage_shape =
+      transposed ? std::vector<int64_t>{shape[1], shape[0]} : shape;
+  at::Tensor storage;
+  if (dtype == at::kBool) {
+    storage = at::ones(storage_shape, at::kBool);
+  } else {
+    storage = at::empty(storage_shape, at::kFloat);
+    float* data = storage.data_ptr<float>();
+    const bool integral = dtype == at::kInt || dtype == at::kLong;
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int64_t i = 0; i < numel; ++i) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      const float u = static_cast<float>(state >> 40) / 16777216.0f;
+      data[i] = integral ? std::floor(u * 7.0f) : u;
+    }
+    if (dtype != at::kFloat) {
+      storage = storage.to(dtype);
+    }
+  }
+  return transposed ? storage.transpose(0, 1) : storage;
+}
+
+static at::Tensor run_reduction(const ReductionCase& c, const at::Tensor& x) {
+  const bool full = c.mode.dim < 0;
+  switch (c.op) {
+    case ReduceOp::kSum:
+      return full ? at::sum(x) : at::sum(x, {c.mode.dim}, c.mode.keepdim);
+    case ReduceOp::kStd:
+      return full ? x.std(/*unbiased=*/true)
+                  : x.std(at::IntArrayRef({c.mode.dim}),
+                          /*unbiased=*/true,
+                          c.mode.keepdim);
+    case ReduceOp::kVar:
+      return full ? x.var(/*unbiased=*/true)
+                  : x.var(at::IntArrayRef({c.mode.dim}),
+                          /*unbiased=*/true,
+                          c.mode.keepdim);
+    case ReduceOp::kAll:
+      return full ? x.all() : x.all(c.mode.dim, c.mode.keepdim);
+    case ReduceOp::kAllClose:
+      break;
+  }
+  return at::Tensor();
+}
+
+// 以 long double 逐元素计算的参考值（两遍法求方差），直接按 stride
+// 访问，不需要额外拷贝，1e9 元素也可计算
+template <typename T>
+static std::vector<double> reference_impl(const at::Tensor& x,
+                                          ReduceOp op,
+                                          int64_t dim) {
+  const T* data = x.data_ptr<T>();
+  const int64_t rows = x.size(0);
+  const int64_t cols = x.size(1);
+  const int64_t s0 = x.stride(0);
+  const int64_t s1 = x.stride(1);
+  const int64_t groups = dim < 0 ? 1 : (dim == 0 ? cols : rows);
+  const int64_t count = dim < 0 ? rows * cols : (dim == 0 ? rows : cols);
+  const auto load = [&](int64_t g, int64_t k) -> long double {
+    int64_t i = 0;
+    int64_t j = 0;
+    if (dim < 0) {
+      i = k / cols;
+      j = k % cols;
+    } else if (dim == 0) {
+      i = k;
+      j = g;
+    } else {
+      i = g;
+      j = k;
+    }
+    return static_cast<long double>(static_cast<double>(data[i * s0 + j * s1]));
+  };
+
+  std::vector<double> out(groups);
+  for (int64_t g = 0; g < groups; ++g) {
+    long double sum = 0.0L;
+    for (int64_t k = 0; k < count; ++k) {
+      sum += load(g, k);
+    }
+    if (op == ReduceOp::kSum) {
+      out[g] = static_cast<double>(sum);
+      continue;
+    }
+    const long double mean = sum / count;
+    long double squares = 0.0L;
+    for (int64_t k = 0; k < count; ++k) {
+      const long double d = load(g, k) - mean;
+      squares += d * d;
+    }
+    const long double var = squares / (count - 1);
+    out[g] = static_cast<double>(op == ReduceOp::kVar ? var : std::sqrt(var));
+  }
+  return out;
+}
+
+static std::vector<double> reference(const at::Tensor& x,
+                                     ReduceOp op,
+                                     int64_t dim) {
+  switch (x.scalar_type()) {
+    case at::kFloat:
+      return reference_impl<float>(x, op, dim);
+    case at::kDouble:
+      return reference_impl<double>(x, op, dim);
+    case at::kHalf:
+      return reference_impl<c10::Half>(x, op, dim);
+    case at::kBFloat16:
+      return reference_impl<c10::BFloat16>(x, op, dim);
+    case at::kInt:
+      return reference_impl<int32_t>(x, op, dim);
+    case at::kLong:
+      return reference_impl<int64_t>(x, op, dim);
+    default:
+      return {};
+  }
+}
+
+// 逐输出元素的最大相对误差（参考值为 0 时取绝对误差）
+static double max_relative_error(const at::Tensor& result,
+                                 const std::vector<double>& expected) {
+  const at::Tensor got = result.to(at::kDouble).contiguous();
+  const double* data = got.data_ptr<double>();
+  double max_error = 0.0;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    const double diff = std::fabs(data[i] - expected[i]);
+    const double scale = std::fabs(expected[i]);
+    max_error = std::max(max_error, scale > 0.0 ? diff / scale : diff);
+  }
+  return max_error;
+}
+
+// Half 的最大有限值。[0, 1) 均匀输入的全量求和在 1e6 元素时已约为
+// 5e5，Half 结果必然溢出为 inf，相对误差没有意义
+constexpr double kHalfMax = 65504.0;
+
+// 参考值超出结果 dtype 的有限范围
+static bool exceeds_result_range(const at::Tensor& result,
+                                 const std::vector<double>& expected) {
+  if (result.scalar_type() != at::kHalf) {
+    return false;
+  }
+  for (double value : expected) {
+    if (std::fabs(value) > kHalfMax) {
+      return true;
+    }
+  }
+  return false;
+}
+
+class ReductionBench : public ::testing::TestWithParam<ReductionCase> {
+ protected:
+  // 只缓存最近一份输入：case 按输入分组展开，大规模下不会同时持有多份
+  static const at::Tensor& input_for(const ReductionCase& c) {
+    static std::tuple<at::ScalarType, int64_t, SweepLayout> key;
+    static at::Tensor input;
+    const auto wanted = std::make_tuple(c.dtype, c.numel, c.layout);
+    if (!input.defined() || key != wanted) {
+      input = at::Tensor();
+      input = make_reduction_input(c.dtype, c.numel, c.layout);
+      key = wanted;
+    }
+    return input;
+  }
+};
+
+TEST_P(ReductionBench, Throughput) {
+  const ReductionCase& c = GetParam();
+  const at::Tensor& x = input_for(c);
+  at::Tensor other;
+  if (c.op == ReduceOp::kAllClose) {
+    other = x.clone();
+  }
+
+  BenchmarkResult result = RunBenchmark(
+      std::string(reduce_op_name(c.op)) + "/" + mode_name(c.mode) + "/" +
+          c10::toString(c.dtype) + "/numel=" + std::to_string(c.numel) + "/" +
+          SweepLayoutName(c.layout),
+      [&] {
+        if (c.op == ReduceOp::kAllClose) {
+          bool close = x.allclose(other);
+          DoNotOptimize(close);
+        } else {
+          at::Tensor r = run_reduction(c, x);
+          DoNotOptimize(r);
+        }
+      },
+      OptionsForNumel(c.numel));
+  const double seconds = result.histogram.percentile(50) * 1e-9;
+  const double bytes =
+      static_cast<double>(c.numel) * c10::elementSize(c.dtype) *
+      (c.op == ReduceOp::kAllClose ? 2.0 : 1.0);
+  result.addCounter("numel", static_cast<double>(c.numel));
+  result.addCounter("bytes_per_s", bytes / seconds);
+  result.addCounter("elements_per_s", c.numel / seconds);
+
+  // 数值误差在计时之外单独计算
+  if (c.op == ReduceOp::kAllClose) {
+    EXPECT_TRUE(x.allclose(other));
+  } else {
+    const at::Tensor r = run_reduction(c, x);
+    result.addLabel("result_dtype", c10::toString(r.scalar_type()));
+    if (c.op == ReduceOp::kAll) {
+      const at::Tensor all_true = r.to(at::kLong).sum();
+      EXPECT_EQ(all_true.item<int64_t>(), r.numel());
+    } else {
+      const std::vector<double> expected = reference(x, c.op, c.mode.dim);
+      const bool overflow = exceeds_result_range(r, expected);
+      // 溢出时不报告 max_rel_error，避免 inf 在 JSON 中变为 null
+      result.addLabel("overflow", overflow ? "true" : "false");
+      const double error = max_relative_error(r, expected);
+      if (!overflow) {
+        result.addCounter("max_rel_error", error);
+      }
+      if (c.dtype == at::kInt || c.dtype == at::kLong) {
+        // 整数求和必须提升到 int64 且结果精确
+        EXPECT_EQ(r.scalar_type(), at::kLong) << c.name();
+        EXPECT_EQ(error, 0.0) << c.name();
+      }
+    }
+  }
+  result.addLabel("api", reduce_op_name(c.op));
+  result.addLabel("mode", mode_name(c.mode));
+  result.addLabel("dtype", c10::toString(c.dtype));
+  result.addLabel("layout", SweepLayoutName(c.layout));
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Reductions,
+    ReductionBench,
+    ::testing::ValuesIn(reduction_cases()),
+    [](const ::testing::TestParamInfo<ReductionCase>& info) {
+      return info.param.name();
+    });
+
+}  // namespace test
+}  // namespace at
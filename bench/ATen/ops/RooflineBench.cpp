@@ -0,0 +1,223 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/abs.h>
+#include <ATen/ops/clamp_min.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/reciprocal.h>
+#include <ATen/ops/std.h>
+#include <ATen/ops/sum.h>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkOptions;
+using paddle_api_test::BenchmarkPlacement;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::MaxBenchmarkThreads;
+using paddle_api_test::MeasureStreamBandwidth;
+using paddle_api_test::RemoteNumaNode;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::StreamBandwidth;
+
+// 输入 tensor 与 STREAM 数组的元素数：环境变量 PADDLE_API_ROOFLINE_NUMEL，
+// 默认 2^24，float 输入 64MB，足以越过常见的末级缓存
+static int64_t roofline_numel() {
+  const char* env = std::getenv("PADDLE_API_ROOFLINE_NUMEL");
+  if (env != nullptr && std::atoll(env) > 0) {
+    return std::atoll(env);
+  }
+  return int64_t{1} << 24;
+}
+
+// traffic 为每元素的必需内存流量（以输入元素大小计）：elementwise 读一次
+// 写一次为 2，fill_ 只写为 1，归约只读为 1。实际流量可能更高（如写分配、
+// 两遍算法），因此 fraction_of_peak 是可达上限的下界估计。
+struct RooflineOp {
+  const char* name;
+  double traffic;
+  std::vector<at::ScalarType> dtypes;
+  std::function<void(at::Tensor&)> run;
+};
+
+static const std::vector<RooflineOp>& roofline_ops() {
+  static const std::vector<at::ScalarType> kNumeric = {at::kFloat,
+                                                       at::kDouble,
+                                                       at::kHalf,
+                                                       at::kBFloat16,
+                                                       at::kInt,
+                                                       at::kLong};
+  static const std::vector<at::ScalarType> kFloating = {
+      at::kFloat, at::kDouble, at::kHalf, at::kBFloat16};
+  static const std::vector<RooflineOp> ops = {
+      {"abs",
+       2.0,
+       kNumeric,
+       [](at::Tensor& x) {
+         at::Tensor r = at::abs(x);
+         DoNotOptimize(r);
+       }},
+      {"reciprocal",
+       2.0,
+       kFloating,
+       [](at::Tensor& x) {
+         at::Tensor r = at::reciprocal(x);
+         DoNotOptimize(r);
+       }},
+      {"clamp_min",
+       2.0,
+       kNumeric,
+       [](at::Tensor& x) {
+         at::Tensor r = at::clamp_min(x, 0);
+         DoNotOptimize(r);
+       }},
+      {"fill_",
+       1.0,
+       kNumeric,
+       [](at::Tensor& x) {
+         at::Tensor& r = x.fill_(1);
+         DoNotOptimize(r);
+       }},
+      {"sum",
+       1.0,
+       kNumeric,
+       [](at::Tensor& x) {
+         at::Tensor r = at::sum(x);
+         DoNotOptimize(r);
+       }},
+      {"std",
+       1.0,
+       {at::kFloat, at::kDouble},
+       [](at::Tensor& x) {
+         at::Tensor r = x.std(/*unbiased=*/true);
+         DoNotOptimize(r);
+       }},
+  };
+  return ops;
+}
+
+struct RooflineCase {
+  size_t op_index;
+  at::ScalarType dtype;
+};
+
+static std::vector<RooflineCase> roofline_cases() {
+  std::vector<RooflineCase> cases;
+  const auto& ops = roofline_ops();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    for (at::ScalarType dtype : ops[i].dtypes) {
+      cases.push_back({i, dtype});
+    }
+  }
+  return cases;
+}
+
+// 同一进程内所有 case 共享一次 STREAM 测量：多线程结果作为机器峰值，
+// 单线程结果用于判断单线程 kernel 是否已经触顶
+class RooflineBench : public ::testing::TestWithParam<RooflineCase> {
+ protected:
+  static void SetUpTestSuite() {
+    const int64_t numel = roofline_numel();
+    peak_ = new StreamBandwidth(
+        MeasureStreamBandwidth(numel, MaxBenchmarkThreads()));
+    single_thread_peak_ =
+        new StreamBandwidth(MeasureStreamBandwidth(numel, 1));
+  }
+
+  static void TearDownTestSuite() {
+    delete peak_;
+    delete single_thread_peak_;
+    peak_ = nullptr;
+    single_thread_peak_ = nullptr;
+  }
+
+  static StreamBandwidth* peak_;
+  static StreamBandwidth* single_thread_peak_;
+};
+
+StreamBandwidth* RooflineBench::peak_ = nullptr;
+StreamBandwidth* RooflineBench::single_thread_peak_ = nullptr;
+
+TEST_P(RooflineBench, Bandwidth) {
+  const RooflineOp& op = roofline_ops()[GetParam().op_index];
+  const at::ScalarType dtype = GetParam().dtype;
+  const int64_t numel = roofline_numel();
+  at::Tensor input = at::ones({numel}, dtype);
+
+  BenchmarkOptions options;
+  options.warmup_iters = 2;
+  options.min_iters = 10;
+  BenchmarkResult result = RunBenchmark(
+      std::string(op.name) + "/" + c10::toString(dtype),
+      [&] { op.run(input); },
+      options);
+
+  // 以 p50 计算吞吐，避免个别被抢占的迭代拉低结果
+  const double seconds = result.histogram.percentile(50) * 1e-9;
+  const double bytes = op.traffic * numel * c10::elementSize(dtype);
+  const double bytes_per_s = bytes / seconds;
+  result.addCounter("numel", static_cast<double>(numel));
+  result.addCounter("bytes_per_s", bytes_per_s);
+  result.addCounter("elements_per_s", numel / seconds);
+  result.addCounter("peak_bytes_per_s", peak_->peak());
+  result.addCounter("stream_threads", peak_->threads);
+  result.addCounter("fraction_of_peak", bytes_per_s / peak_->peak());
+  result.addCounter("fraction_of_single_thread_peak",
+                    bytes_per_s / single_thread_peak_->peak());
+  result.addLabel("api", op.name);
+  result.addLabel("op", op.name);
+  result.addLabel("dtype", c10::toString(dtype));
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Kernels,
+    RooflineBench,
+    ::testing::ValuesIn(roofline_cases()),
+    [](const ::testing::TestParamInfo<RooflineCase>& info) {
+      return std::string(roofline_ops()[info.param.op_index].name) + "_" +
+             c10::toString(info.param.dtype);
+    });
+
+// 同一进程、同一组线程下，把 STREAM 数组分别绑定到线程所在节点与远端
+// 节点，remote_ratio 为远端 / 本地峰值带宽。需要 PADDLE_API_BENCH_NUMA
+// 把线程固定在 PADDLE_API_BENCH_CPU_NODE 上，否则线程可能在节点间漂移
+TEST(RooflinePlacementBench, RemoteAccessPenalty) {
+  const BenchmarkPlacement& placement = BenchmarkPlacement::Get();
+  if (placement.cpu_node < 0) {
+    GTEST_SKIP() << "set PADDLE_API_BENCH_NUMA=local|cross to pin the threads";
+  }
+  const int remote_node = RemoteNumaNode(placement.cpu_node);
+  if (remote_node < 0) {
+    GTEST_SKIP() << "needs 2+ online NUMA nodes";
+  }
+  const int64_t numel = roofline_numel();
+  const int threads = MaxBenchmarkThreads();
+  const StreamBandwidth local =
+      MeasureStreamBandwidth(numel, threads, placement.cpu_node);
+  const StreamBandwidth remote =
+      MeasureStreamBandwidth(numel, threads, remote_node);
+  ASSERT_EQ(local.mem_node, placement.cpu_node) << "mbind failed";
+  ASSERT_EQ(remote.mem_node, remote_node) << "mbind failed";
+
+  BenchmarkResult result("stream/remote_penalty");
+  result.addCounter("threads", threads);
+  result.addCounter("local_node", local.mem_node);
+  result.addCounter("remote_node", remote.mem_node);
+  result.addCounter("local_bytes_per_s", local.peak());
+  result.addCounter("remote_bytes_per_s", remote.peak());
+  result.addCounter("remote_ratio", remote.peak() / local.peak());
+  ReportBenchmark(result);
+}
+
+}  // namespace test
+}  // namespace at
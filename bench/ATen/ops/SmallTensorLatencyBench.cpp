@@ -0,0 +1,104 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/tensor.h>
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+
+// api 标签为被测 API 的限定名，供覆盖率报告按 API 归属
+template <typename Fn>
+static void run_latency(const std::string& api,
+                        const std::string& name,
+                        Fn&& fn) {
+  BenchmarkResult result = RunBenchmark(name, fn);
+  result.addLabel("api", api);
+  ReportBenchmark(result);
+}
+
+// 小 tensor 路径的延迟分布：这些调用的耗时几乎全部来自框架开销，
+// 尾延迟比吞吐更能反映线上表现。
+class SmallTensorLatencyBench : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scalar_float = at::zeros({}, at::kFloat);
+    scalar_float.fill_(3.14f);
+    scalar_long = at::zeros({}, at::kLong);
+    scalar_long.fill_(42);
+    small_float = at::zeros({2, 3, 4}, at::kFloat);
+  }
+
+  at::Tensor scalar_float;
+  at::Tensor scalar_long;
+  at::Tensor small_float;
+};
+
+TEST_F(SmallTensorLatencyBench, Item) {
+  run_latency("at::Tensor::item", "item/float", [&] {
+    at::Scalar s = scalar_float.item();
+    DoNotOptimize(s);
+  });
+  run_latency("at::Tensor::item", "item<float>", [&] {
+    float v = scalar_float.item<float>();
+    DoNotOptimize(v);
+  });
+  run_latency("at::Tensor::item", "item<int64_t>", [&] {
+    int64_t v = scalar_long.item<int64_t>();
+    DoNotOptimize(v);
+  });
+}
+
+TEST_F(SmallTensorLatencyBench, TensorFactory) {
+  std::vector<float> one = {1.0f};
+  std::vector<float> four = {1.0f, 2.0f, 3.0f, 4.0f};
+  std::vector<int64_t> index = {0, 1, 2};
+  run_latency("at::tensor", "tensor/float/1", [&] {
+    at::Tensor t = at::tensor(at::ArrayRef<float>(one),
+                              at::TensorOptions().dtype(at::kFloat));
+    DoNotOptimize(t);
+  });
+  run_latency("at::tensor", "tensor/float/4", [&] {
+    at::Tensor t = at::tensor(at::ArrayRef<float>(four),
+                              at::TensorOptions().dtype(at::kFloat));
+    DoNotOptimize(t);
+  });
+  run_latency("at::tensor", "tensor/long/3", [&] {
+    at::Tensor t = at::tensor(at::ArrayRef<int64_t>(index),
+                              at::TensorOptions().dtype(at::kLong));
+    DoNotOptimize(t);
+  });
+}
+
+TEST_F(SmallTensorLatencyBench, To) {
+  run_latency("at::Tensor::to", "to/float->double/scalar", [&] {
+    at::Tensor t = scalar_float.to(at::kDouble);
+    DoNotOptimize(t);
+  });
+  run_latency("at::Tensor::to", "to/float->double/2x3x4", [&] {
+    at::Tensor t = small_float.to(at::kDouble);
+    DoNotOptimize(t);
+  });
+  run_latency("at::Tensor::to", "to/float->float/noop", [&] {
+    at::Tensor t = small_float.to(at::kFloat);
+    DoNotOptimize(t);
+  });
+  run_latency("at::Tensor::to", "to/float->float/copy", [&] {
+    at::Tensor t =
+        small_float.to(at::kFloat, /*non_blocking=*/false, /*copy=*/true);
+    DoNotOptimize(t);
+  });
+}
+
+}  // namespace test
+}  // namespace at
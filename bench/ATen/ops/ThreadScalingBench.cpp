@@ -0,0 +1,155 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/cat.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/ones.h>
+#include <ATen/ops/sum.h>
+#include <ATen/ops/zeros.h>
+#include <gtest/gtest.h>
+
+#if __has_include(<ATen/Parallel.h>)
+#include <ATen/Parallel.h>
+#define BENCH_HAS_ATEN_PARALLEL 1
+#else
+#define BENCH_HAS_ATEN_PARALLEL 0
+#endif
+
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::MaxBenchmarkThreads;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::RunThreadedBenchmark;
+using paddle_api_test::ScalingThreadCounts;
+
+// 以 1 线程的单线程吞吐为基准，依次在 1..N 个线程上运行同一算子。
+// scaling_efficiency = 当前单线程吞吐 / 1 线程吞吐，理想值为 1；
+// 分配器锁、全局分发表或引用计数竞争会让它随线程数下降。
+template <typename Fn>
+static void run_scaling(const std::string& api,
+                        const std::string& name,
+                        Fn&& fn) {
+  double baseline_per_thread = 0.0;
+  for (int n : ScalingThreadCounts()) {
+    BenchmarkResult result =
+        RunThreadedBenchmark(name + "/threads=" + std::to_string(n), n, fn);
+    const double per_thread = result.counter("ops_per_s_per_thread");
+    if (n == 1) {
+      baseline_per_thread = per_thread;
+    }
+    result.addCounter("scaling_efficiency",
+                      baseline_per_thread > 0.0
+                          ? per_thread / baseline_per_thread
+                          : 0.0);
+    result.addLabel("api", api);
+    ReportBenchmark(result);
+  }
+}
+
+class ThreadScalingBench : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const int max_threads = MaxBenchmarkThreads();
+    for (int t = 0; t < max_threads; ++t) {
+      independent.push_back(at::ones({256, 256}, at::kFloat));
+      independent_small.push_back(at::ones({64, 64}, at::kFloat));
+    }
+    shared = at::ones({256, 256}, at::kFloat);
+    shared_small = at::ones({64, 64}, at::kFloat);
+  }
+
+  // 每个线程独占一份输入
+  std::vector<at::Tensor> independent;
+  std::vector<at::Tensor> independent_small;
+  // 所有线程读取同一份输入，额外暴露 TensorImpl 引用计数的竞争
+  at::Tensor shared;
+  at::Tensor shared_small;
+};
+
+TEST_F(ThreadScalingBench, Empty) {
+  run_scaling("at::empty", "empty/64x64", [](int) {
+    at::Tensor t = at::empty({64, 64}, at::kFloat);
+    DoNotOptimize(t);
+  });
+}
+
+TEST_F(ThreadScalingBench, Zeros) {
+  run_scaling("at::zeros", "zeros/64x64", [](int) {
+    at::Tensor t = at::zeros({64, 64}, at::kFloat);
+    DoNotOptimize(t);
+  });
+}
+
+TEST_F(ThreadScalingBench, Sum) {
+  run_scaling("at::sum", "sum/256x256/independent", [&](int t) {
+    at::Tensor r = at::sum(independent[t]);
+    DoNotOptimize(r);
+  });
+  run_scaling("at::sum", "sum/256x256/shared", [&](int) {
+    at::Tensor r = at::sum(shared);
+    DoNotOptimize(r);
+  });
+}
+
+TEST_F(ThreadScalingBench, Cat) {
+  run_scaling("at::cat", "cat/2x64x64/independent", [&](int t) {
+    std::vector<at::Tensor> tensors = {independent_small[t],
+                                       independent_small[t]};
+    at::Tensor r = at::cat(tensors, 0);
+    DoNotOptimize(r);
+  });
+  run_scaling("at::cat", "cat/2x64x64/shared", [&](int) {
+    std::vector<at::Tensor> tensors = {shared_small, shared_small};
+    at::Tensor r = at::cat(tensors, 0);
+    DoNotOptimize(r);
+  });
+}
+
+// 单个调用线程，扫描算子内部并行度 at::set_num_threads
+TEST_F(ThreadScalingBench, IntraOpSum) {
+#if BENCH_HAS_ATEN_PARALLEL
+  at::Tensor large = at::ones({1 << 22}, at::kFloat);
+  const int original = at::get_num_threads();
+  double baseline_ns = 0.0;
+  for (int n : ScalingThreadCounts()) {
+    at::set_num_threads(n);
+    BenchmarkResult result =
+        RunBenchmark("sum/4M/intra_op=" + std::to_string(n), [&] {
+          at::Tensor r = at::sum(large);
+          DoNotOptimize(r);
+        });
+    const double mean_ns = result.histogram.mean();
+    if (n == 1) {
+      baseline_ns = mean_ns;
+    }
+    result.addCounter("intra_op_threads", at::get_num_threads());
+    result.addCounter("speedup", mean_ns > 0.0 ? baseline_ns / mean_ns : 0.0);
+    result.addCounter("scaling_efficiency",
+                      mean_ns > 0.0 ? baseline_ns / mean_ns / n : 0.0);
+    result.addLabel("api", "at::sum");
+    ReportBenchmark(result);
+  }
+  at::set_num_threads(original);
+#else
+  // 不跳过：按 Torch 的 case 名为每个线程数输出一条不含计时的结果，
+  // 使对比报告中缺失的 API 与 Torch 的记录逐行配对
+  for (int n : ScalingThreadCounts()) {
+    BenchmarkResult result("sum/4M/intra_op=" + std::to_string(n));
+    result.addLabel("api", "at::set_num_threads");
+    result.addLabel("status", "unsupported");
+    result.addLabel("missing_api", "ATen/Parallel.h");
+    ReportBenchmark(result);
+  }
+#endif
+}
+
+}  // namespace test
+}  // namespace at
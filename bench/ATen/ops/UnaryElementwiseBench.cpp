@@ -0,0 +1,255 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/abs.h>
+#include <ATen/ops/clamp_min.h>
+#include <ATen/ops/fill.h>
+#include <ATen/ops/reciprocal.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "bench/common/data_allocation_counter.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountDataAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::InstallDataAllocationCounter;
+using paddle_api_test::MakeSweepTensor;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::ShapeForNumel;
+using paddle_api_test::SweepLayout;
+using paddle_api_test::SweepNumels;
+
+constexpr int64_t kDataAllocationProbeCalls = 2;
+
+// 输入布局：前三种由 MakeSweepTensor 构造（sliced 即末维步长为 2 的
+// 切片），broadcast 为单行 expand 出的 stride-0 视图
+enum class UnaryLayout { kContiguous, kTransposed, kSliced, kBroadcast };
+
+static const char* unary_layout_name(UnaryLayout layout) {
+  switch (layout) {
+    case UnaryLayout::kContiguous:
+      return "contiguous";
+    case UnaryLayout::kTransposed:
+      return "transposed";
+    case UnaryLayout::kSliced:
+      return "sliced";
+    case UnaryLayout::kBroadcast:
+      return "broadcast";
+  }
+  return "unknown";
+}
+
+// in_place 的算子写回输入，不能作用于 broadcast（多个元素共享同一地址）
+struct UnaryOp {
+  const char* name;
+  bool in_place;
+  std::vector<at::ScalarType> dtypes;
+  std::function<at::Tensor(at::Tensor&)> run;
+};
+
+static const std::vector<UnaryOp>& unary_ops() {
+  const std::vector<at::ScalarType> numeric = {at::kFloat,
+                                               at::kDouble,
+                                               at::kHalf,
+                                               at::kBFloat16,
+                                               at::kInt,
+                                               at::kLong};
+  const std::vector<at::ScalarType> floating = {
+      at::kFloat, at::kDouble, at::kHalf, at::kBFloat16};
+  static const std::vector<UnaryOp> ops = {
+      {"abs", false, numeric, [](at::Tensor& x) { return at::abs(x); }},
+      {"abs_", true, numeric, [](at::Tensor& x) { return x.abs_(); }},
+      // 整数输入的 reciprocal 结果提升为浮点，原地版本只支持浮点
+      {"reciprocal",
+       false,
+       numeric,
+       [](at::Tensor& x) { return at::reciprocal(x); }},
+      {"reciprocal_",
+       true,
+       floating,
+       [](at::Tensor& x) { return x.reciprocal_(); }},
+      {"clamp_min",
+       false,
+       numeric,
+       [](at::Tensor& x) { return at::clamp_min(x, 0); }},
+      {"clamp_min_",
+       true,
+       numeric,
+       [](at::Tensor& x) { return x.clamp_min_(0); }},
+      {"fill_",
+       true,
+       {at::kFloat,
+        at::kDouble,
+        at::kHalf,
+        at::kBFloat16,
+        at::kInt,
+        at::kLong,
+        at::kBool},
+       [](at::Tensor& x) { return x.fill_(1); }},
+  };
+  return ops;
+}
+
+struct UnaryCase {
+  size_t op_index;
+  at::ScalarType dtype;
+  int64_t numel;
+  UnaryLayout layout;
+
+  std::string name() const {
+    return std::string(unary_ops()[op_index].name) + "_" +
+           c10::toString(dtype) + "_" + std::to_string(numel) + "_" +
+           unary_layout_name(layout);
+  }
+};
+
+// 默认到 1e7 元素；PADDLE_API_SWEEP_MAX_NUMEL=100000000 放开到 1e8
+static std::vector<int64_t> unary_numels() {
+  return SweepNumels({10000, 1000000, 10000000, 100000000}, 10000000);
+}
+
+// 同一算子 / dtype / 规模下 contiguous 排在最前，供其余布局作为基线
+static std::vector<UnaryCase> unary_cases() {
+  std::vector<UnaryCase> cases;
+  const auto& ops = unary_ops();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    for (at::ScalarType dtype : ops[i].dtypes) {
+      for (int64_t numel : unary_numels()) {
+        for (UnaryLayout layout : {UnaryLayout::kContiguous,
+                                   UnaryLayout::kTransposed,
+                                   UnaryLayout::kSliced,
+                                   UnaryLayout::kBroadcast}) {
+          if (ops[i].in_place && layout == UnaryLayout::kBroadcast) {
+            continue;
+          }
+          cases.push_back({i, dtype, numel, layout});
+        }
+      }
+    }
+  }
+  return cases;
+}
+
+// 逻辑 shape 固定为 ShapeForNumel(numel, 2)，各布局的元素数相同
+static at::Tensor make_unary_input(const UnaryCase& c) {
+  const std::vector<int64_t> shape = ShapeForNumel(c.numel, 2);
+  switch (c.layout) {
+    case UnaryLayout::kContiguous:
+      return MakeSweepTensor({c.dtype, shape, SweepLayout::kContiguous});
+    case UnaryLayout::kTransposed:
+      return MakeSweepTensor({c.dtype, shape, SweepLayout::kTransposed});
+    case UnaryLayout::kSliced:
+      return MakeSweepTensor({c.dtype, shape, SweepLayout::kStrided});
+    case UnaryLayout::kBroadcast:
+      return MakeSweepTensor({c.dtype, {shape[1]}, SweepLayout::kContiguous})
+          .unsqueeze(0)
+          .expand(shape);
+  }
+  return at::Tensor();
+}
+
+class UnaryElementwiseBench : public ::testing::TestWithParam<UnaryCase> {
+ protected:
+  // 同一算子 / dtype / 规模在连续输入上的 p50
+  static std::map<std::tuple<size_t, at::ScalarType, int64_t>, double>&
+  contiguous_p50s() {
+    static std::map<std::tuple<size_t, at::ScalarType, int64_t>, double>
+        cache;
+    return cache;
+  }
+};
+
+// elements_per_s 按逻辑元素数计算。数据分配量可测时（见
+// bench/common/data_allocation_counter.h），超出结果本身存储的部分即隐式拷贝：
+// 非原地算子应只分配输出，原地算子不应分配任何数据缓冲区。
+// strides_preserved 表示非原地结果是否沿用输入的 stride（Torch 的
+// TensorIterator 行为，AbsTest.NonContiguousTensor 的差异即源于此）
+TEST_P(UnaryElementwiseBench, Throughput) {
+  const UnaryCase& c = GetParam();
+  const UnaryOp& op = unary_ops()[c.op_index];
+  at::Tensor x = make_unary_input(c);
+
+  BenchmarkResult result = RunBenchmark(
+      std::string(op.name) + "/" + c10::toString(c.dtype) +
+          "/numel=" + std::to_string(c.numel) + "/" +
+          unary_layout_name(c.layout),
+      [&] {
+        at::Tensor r = op.run(x);
+        DoNotOptimize(r);
+      },
+      OptionsForNumel(c.numel));
+  const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+  const double elem_bytes = static_cast<double>(c10::elementSize(c.dtype));
+  result.addCounter("numel", static_cast<double>(c.numel));
+  result.addCounter("elements_per_s", c.numel / (p50_ns * 1e-9));
+  // fill_ 只写不读，其余算子读写各一遍
+  result.addCounter(
+      "bytes_per_s",
+      c.numel * elem_bytes * (op.name == std::string("fill_") ? 1.0 : 2.0) /
+          (p50_ns * 1e-9));
+
+  const auto key = std::make_tuple(c.op_index, c.dtype, c.numel);
+  if (c.layout == UnaryLayout::kContiguous) {
+    contiguous_p50s()[key] = p50_ns;
+  } else if (contiguous_p50s().count(key) != 0) {
+    result.addCounter("slowdown_vs_contiguous",
+                      p50_ns / contiguous_p50s()[key]);
+  }
+
+  const at::Tensor out = op.run(x);
+  if (op.in_place) {
+    EXPECT_EQ(out.data_ptr(), x.data_ptr()) << c.name();
+  } else {
+    result.addCounter("strides_preserved",
+                      out.strides().vec() == x.strides().vec() ? 1.0 : 0.0);
+  }
+  result.addCounter("output_contiguous", out.is_contiguous() ? 1.0 : 0.0);
+
+  if (InstallDataAllocationCounter()) {
+    const AllocationStats allocs = CountDataAllocations(
+        [&] {
+          at::Tensor r = op.run(x);
+          DoNotOptimize(r);
+        },
+        kDataAllocationProbeCalls);
+    const double output_bytes =
+        op.in_place ? 0.0 : static_cast<double>(out.nbytes());
+    const double extra_bytes = std::max(
+        0.0,
+        static_cast<double>(allocs.bytes) / kDataAllocationProbeCalls -
+            output_bytes);
+    result.addCounter("extra_bytes_per_call", extra_bytes);
+    result.addCounter("hidden_copy", extra_bytes > 0.0 ? 1.0 : 0.0);
+  } else {
+    result.addLabel("hidden_copy", "unmeasurable");
+  }
+  result.addLabel("api", op.name);
+  result.addLabel("dtype", c10::toString(c.dtype));
+  result.addLabel("layout", unary_layout_name(c.layout));
+  ReportBenchmark(result);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Ops,
+    UnaryElementwiseBench,
+    ::testing::ValuesIn(unary_cases()),
+    [](const ::testing::TestParamInfo<UnaryCase>& info) {
+      return info.param.name();
+    });
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,112 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+#include "src/view_complexity_cases.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkOptions;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SweepSpec;
+using paddle_api_test::ViewInputs;
+using paddle_api_test::ViewInputsSuite;
+using paddle_api_test::ViewOpCase;
+using paddle_api_test::ViewOpCaseName;
+using paddle_api_test::ViewOpCases;
+using paddle_api_test::kConstantTimeMaxGrowth;
+using paddle_api_test::kConstantTimeSlackNs;
+
+// view 类算子与元数据访问只改写 shape / stride，耗时应与元素数无关。
+// 分别在 1e2 / 1e5 / 1e8 元素上计时，超出 kConstantTimeMaxGrowth 阈值
+// 即判定为隐式拷贝。结构上的视图检查见 test/ATen/ops/ViewComplexityTest.cpp
+
+// 各规模的输入在整个 suite 内共享，避免每个用例重复分配 400MB；
+// 超过 PADDLE_API_SWEEP_MAX_NUMEL 的规模被跳过
+class ViewComplexityBenchBase
+    : public ViewInputsSuite<ViewComplexityBenchBase> {
+ public:
+  static int64_t MaxNumel() { return SweepSpec::SweepMaxNumel(100000000); }
+};
+
+class ViewComplexityBench
+    : public ViewComplexityBenchBase,
+      public ::testing::WithParamInterface<ViewOpCase> {};
+
+class MetadataComplexityBench : public ViewComplexityBenchBase {};
+
+// 每个规模报告一条结果，growth_vs_smallest 为相对最小规模的 p50 之比；
+// 最大规模超出阈值时判定为随元素数增长
+template <typename Fn>
+static void run_complexity(const std::string& api,
+                           const std::vector<ViewInputs>& inputs,
+                           Fn&& fn) {
+  BenchmarkOptions options;
+  options.warmup_iters = 16;
+  options.min_iters = 256;
+  options.max_iters = 256;
+  options.min_time_s = 0.0;
+  double smallest_ns = 0.0;
+  for (const ViewInputs& in : inputs) {
+    const int64_t numel = in.x.numel();
+    BenchmarkResult result = RunBenchmark(
+        "complexity/" + api + "/numel=" + std::to_string(numel),
+        [&] { fn(in); },
+        options);
+    const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+    if (smallest_ns == 0.0) {
+      smallest_ns = p50_ns;
+    }
+    result.addCounter("numel", static_cast<double>(numel));
+    result.addCounter("growth_vs_smallest",
+                      smallest_ns > 0.0 ? p50_ns / smallest_ns : 1.0);
+    result.addLabel("api", api);
+    ReportBenchmark(result);
+    EXPECT_LE(p50_ns,
+              kConstantTimeMaxGrowth * smallest_ns + kConstantTimeSlackNs)
+        << api << " grows with numel: " << smallest_ns
+        << " ns at the smallest size, " << p50_ns << " ns at numel " << numel;
+  }
+}
+
+TEST_P(ViewComplexityBench, ConstantTime) {
+  const ViewOpCase& op = GetParam();
+  run_complexity(op.name, *inputs_, [&](const ViewInputs& in) {
+    at::Tensor r = op.fn(in);
+    DoNotOptimize(r);
+  });
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ViewOps,
+    ViewComplexityBench,
+    ::testing::ValuesIn(ViewOpCases()),
+    ViewOpCaseName);
+
+// 元数据访问器在各规模上同样应为常数时间
+TEST_F(MetadataComplexityBench, ConstantTime) {
+  run_complexity("sizes", *inputs_, [](const ViewInputs& in) {
+    at::IntArrayRef r = in.x.sizes();
+    DoNotOptimize(r);
+  });
+  run_complexity("strides", *inputs_, [](const ViewInputs& in) {
+    at::IntArrayRef r = in.x.strides();
+    DoNotOptimize(r);
+  });
+  run_complexity("numel", *inputs_, [](const ViewInputs& in) {
+    int64_t r = in.x.numel();
+    DoNotOptimize(r);
+  });
+}
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,255 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/flatten.h>
+#include <ATen/ops/narrow.h>
+#include <ATen/ops/permute.h>
+#include <ATen/ops/reshape.h>
+#include <ATen/ops/select.h>
+#include <ATen/ops/slice.h>
+#include <ATen/ops/squeeze.h>
+#include <ATen/ops/transpose.h>
+#include <ATen/ops/unsqueeze.h>
+#include <ATen/ops/view.h>
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::MakeSweep;
+using paddle_api_test::MakeSweepTensor;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SubtractEmptyCallBaseline;
+using paddle_api_test::SweepCase;
+using paddle_api_test::SweepLayout;
+using paddle_api_test::SweepLayoutName;
+using paddle_api_test::SweepSpec;
+
+constexpr int64_t kAllocationProbeCalls = 256;
+
+// 输入及其派生张量，派生张量在计时前构造，只测量目标算子本身
+struct ViewInputs {
+  at::Tensor x;           // 按 SweepCase 构造，可能非连续
+  at::Tensor unsqueezed;  // x.unsqueeze(1)，供 squeeze 使用
+  at::Tensor split_like;  // 末维拆成 {2, n / 2} 的 shape，供 view_as 使用
+  at::Tensor t_like;      // x.t() 的 shape，仅 rank == 2，供 t + view_as 使用
+};
+
+// 视图语义：kAlways 的算子在任何布局下都必须返回共享存储的视图；
+// kIfContiguous 的算子（reshape / flatten）只在输入连续时保证不拷贝
+enum class AliasContract { kAlways, kIfContiguous };
+
+struct ViewBenchOp {
+  const char* name;
+  AliasContract contract;
+  std::function<bool(const SweepCase&)> applies;
+  std::function<at::Tensor(const ViewInputs&)> run;
+};
+
+static std::vector<int64_t> split_last_dim(at::IntArrayRef sizes) {
+  const size_t rank = sizes.size();
+  std::vector<int64_t> shape(sizes.begin(), sizes.begin() + rank - 1);
+  shape.push_back(2);
+  shape.push_back(sizes[rank - 1] / 2);
+  return shape;
+}
+
+static std::vector<int64_t> merge_last_dims(at::IntArrayRef sizes) {
+  const size_t rank = sizes.size();
+  std::vector<int64_t> shape(sizes.begin(), sizes.begin() + rank - 2);
+  shape.push_back(sizes[rank - 2] * sizes[rank - 1]);
+  return shape;
+}
+
+static const std::vector<ViewBenchOp>& view_bench_ops() {
+  const auto any = [](const SweepCase&) { return true; };
+  const auto matrix = [](const SweepCase& c) { return c.shape.size() == 2; };
+  static const std::vector<ViewBenchOp> ops = {
+      // 拆分单个维度在任何 stride 下都可以表示为视图
+      {"view",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.view(split_last_dim(in.x.sizes()));
+       }},
+      {"reshape",
+       AliasContract::kIfContiguous,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.reshape(merge_last_dims(in.x.sizes()));
+       }},
+      {"flatten",
+       AliasContract::kIfContiguous,
+       any,
+       [](const ViewInputs& in) { return in.x.flatten(); }},
+      {"unflatten",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.unflatten(0, {2, in.x.size(0) / 2});
+       }},
+      {"permute",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         std::vector<int64_t> dims(in.x.dim());
+         for (int64_t i = 0; i < in.x.dim(); ++i) {
+           dims[i] = in.x.dim() - 1 - i;
+         }
+         return in.x.permute(dims);
+       }},
+      {"transpose",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) { return in.x.transpose(0, -1); }},
+      {"narrow",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.narrow(0, 1, in.x.size(0) - 2);
+       }},
+      {"slice",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.slice(0, 0, in.x.size(0), 2);
+       }},
+      {"select",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) { return in.x.select(0, 1); }},
+      {"squeeze",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) { return in.unsqueezed.squeeze(1); }},
+      {"unsqueeze",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) { return in.x.unsqueeze(0); }},
+      {"t",
+       AliasContract::kAlways,
+       matrix,
+       [](const ViewInputs& in) { return in.x.t(); }},
+      {"view_as",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) { return in.x.view_as(in.split_like); }},
+      {"t_view_as",
+       AliasContract::kAlways,
+       matrix,
+       [](const ViewInputs& in) { return in.x.t().view_as(in.t_like); }},
+      // 预处理代码中常见的视图链，整体也应与元素数无关
+      {"chain",
+       AliasContract::kAlways,
+       any,
+       [](const ViewInputs& in) {
+         return in.x.transpose(0, -1)
+             .unsqueeze(0)
+             .narrow(1, 0, 1)
+             .squeeze(0)
+             .select(0, 0);
+       }},
+  };
+  return ops;
+}
+
+struct ViewBenchCase {
+  size_t op_index;
+  SweepCase sweep_case;
+};
+
+// 各 rank 固定 65536 个 float：维度都是偶数，拆分 / 步长切片均合法。
+// strided 布局即末维步长为 2 的切片输入
+static std::vector<ViewBenchCase> view_bench_cases() {
+  SweepSpec spec;
+  spec.dtypes = {at::kFloat};
+  spec.ranks = {2, 3, 4};
+  spec.numels = {65536};
+  spec.layouts = {SweepLayout::kContiguous,
+                  SweepLayout::kTransposed,
+                  SweepLayout::kStrided};
+  spec.max_numel = 65536;
+  std::vector<ViewBenchCase> cases;
+  const auto& ops = view_bench_ops();
+  for (size_t i = 0; i < ops.size(); ++i) {
+    for (const SweepCase& sweep_case : MakeSweep(spec)) {
+      if (ops[i].applies(sweep_case)) {
+        cases.push_back({i, sweep_case});
+      }
+    }
+  }
+  return cases;
+}
+
+class ViewFamilyBench : public ::testing::TestWithParam<ViewBenchCase> {};
+
+TEST_P(ViewFamilyBench, Latency) {
+  const ViewBenchOp& op = view_bench_ops()[GetParam().op_index];
+  const SweepCase& sweep_case = GetParam().sweep_case;
+  ViewInputs in;
+  in.x = MakeSweepTensor(sweep_case);
+  in.unsqueezed = in.x.unsqueeze(1);
+  in.split_like = at::empty(split_last_dim(in.x.sizes()), in.x.options());
+  if (in.x.dim() == 2) {
+    in.t_like = at::empty({in.x.size(1), in.x.size(0)}, in.x.options());
+  }
+
+  BenchmarkResult result =
+      RunBenchmark(std::string(op.name) + "/" + sweep_case.name(), [&] {
+        at::Tensor r = op.run(in);
+        DoNotOptimize(r);
+      });
+  SubtractEmptyCallBaseline(&result);
+
+  // 拷贝量在计时之外单独判断：共享存储记为 0，否则为结果的全部字节
+  const at::Tensor out = op.run(in);
+  const bool aliases = out.is_alias_of(in.x);
+  const double bytes_copied =
+      aliases ? 0.0 : static_cast<double>(out.numel()) * out.element_size();
+  const AllocationStats allocs = CountAllocations(
+      [&] {
+        at::Tensor r = op.run(in);
+        DoNotOptimize(r);
+      },
+      kAllocationProbeCalls);
+  result.addCounter("rank", static_cast<double>(sweep_case.shape.size()));
+  result.addCounter("is_alias", aliases ? 1.0 : 0.0);
+  result.addCounter("bytes_copied", bytes_copied);
+  result.addCounter(
+      "allocs_per_call",
+      static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+  result.addLabel("api", op.name);
+  result.addLabel("layout", SweepLayoutName(sweep_case.layout));
+  ReportBenchmark(result);
+
+  if (op.contract == AliasContract::kAlways ||
+      sweep_case.layout == SweepLayout::kContiguous) {
+    EXPECT_TRUE(aliases) << op.name << " copied " << bytes_copied
+                         << " bytes on " << sweep_case.name();
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Ops,
+    ViewFamilyBench,
+    ::testing::ValuesIn(view_bench_cases()),
+    [](const ::testing::TestParamInfo<ViewBenchCase>& info) {
+      return std::string(view_bench_ops()[info.param.op_index].name) + "_" +
+             info.param.sweep_case.name();
+    });
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,288 @@
+#!/usr/bin/env python3
+"""
+Paddle / Torch 性能对比工具
+
+运行 <BUILD_PATH>/bench/{paddle,torch} 下的 benchmark 二进制，读取
+/tmp/paddle_cpp_api_test/<binary>.txt 中逐行输出的 JSON 记录，
+按 (binary, case) 配对后输出延迟分位对比，并导出直方图供叠加绘图。
+
+用法:
+    python3 bench/bench_cmp.py <BUILD_PATH> [--filter Item] [--no-run]
+        [--hist-dir DIR] [--json OUT] [-- <gtest/bench 参数>]
+"""
+
+import argparse
+import csv
+import json
+import os
+import re
+import subprocess
+import sys
+
+RESULT_FILE_PATH = "/tmp/paddle_cpp_api_test/"
+FRAMEWORKS = ("paddle", "torch")
+
+
+def list_executables(exec_path, prefix, name_filter):
+    """列出目录下以 <prefix>_ 开头的可执行文件"""
+    if not os.path.isdir(exec_path):
+        return []
+    executables = []
+    for filename in sorted(os.listdir(exec_path)):
+        full_path = os.path.join(exec_path, filename)
+        # 只运行 gtest 形式的 *Bench 二进制，跳过 first_op_startup 等独立探针
+        if not filename.startswith(prefix + "_") or "Bench" not in filename:
+            continue
+        if not (os.path.isfile(full_path) and os.access(full_path, os.X_OK)):
+            continue
+        if name_filter and not re.search(name_filter, filename):
+            continue
+        executables.append(full_path)
+    return executables
+
+
+def run_benchmarks(build_path, name_filter, extra_args):
+    """依次运行两个框架的 benchmark 二进制，返回失败的二进制列表"""
+    failed = []
+    for framework in FRAMEWORKS:
+        exec_path = os.path.join(build_path, "bench", framework)
+        for exe in list_executables(exec_path, framework, name_filter):
+            print(f"Executing {framework} benchmark: {os.path.basename(exe)}")
+            ret = subprocess.call([exe, *extra_args])
+            if ret != 0:
+                failed.append(exe)
+    return failed
+
+
+def load_results(framework, name_filter):
+    """读取某个框架的全部结果，返回 {(binary_key, case): record}"""
+    results = {}
+    if not os.path.isdir(RESULT_FILE_PATH):
+        return results
+    prefix = framework + "_"
+    for filename in sorted(os.listdir(RESULT_FILE_PATH)):
+        if not (filename.startswith(prefix) and filename.endswith(".txt")):
+            continue
+        binary = filename[: -len(".txt")]
+        if "Bench" not in binary:
+            continue
+        if name_filter and not re.search(name_filter, binary):
+            continue
+        key = binary[len(prefix) :]
+        path = os.path.join(RESULT_FILE_PATH, filename)
+        with open(path, encoding="utf-8") as f:
+            for line in f:
+                line = line.strip()
+                if not line.startswith("{"):
+                    continue
+                record = json.loads(line)
+                results[(key, record["name"])] = record
+    return results
+
+
+def ratio(paddle_value, torch_value):
+    if not torch_value:
+        return None
+    return paddle_value / torch_value
+
+
+def format_ratio(value):
+    return "N/A" if value is None else f"{value:.2f}x"
+
+
+def record_status(record):
+    """不含计时的记录（如缺少 API）在 labels.status 中说明原因"""
+    if not record:
+        return None
+    return (record.get("labels") or {}).get("status")
+
+
+def compare(paddle_results, torch_results):
+    """按 case 配对，返回对比行列表"""
+    rows = []
+    for key in sorted(set(paddle_results) | set(torch_results)):
+        paddle = paddle_results.get(key)
+        torch = torch_results.get(key)
+        row = {"binary": key[0], "name": key[1]}
+        for field in ("mean_ns", "p50_ns", "p90_ns", "p99_ns", "p999_ns"):
+            row[f"paddle_{field}"] = paddle[field] if paddle else None
+            row[f"torch_{field}"] = torch[field] if torch else None
+        row["paddle_max_ns"] = paddle["max_ns"] if paddle else None
+        row["torch_max_ns"] = torch["max_ns"] if torch else None
+        row["paddle_status"] = record_status(paddle)
+        row["torch_status"] = record_status(torch)
+        if (
+            paddle
+            and torch
+            and not (row["paddle_status"] or row["torch_status"])
+        ):
+            row["p50_ratio"] = ratio(paddle["p50_ns"], torch["p50_ns"])
+            row["p99_ratio"] = ratio(paddle["p99_ns"], torch["p99_ns"])
+            row["p999_ratio"] = ratio(paddle["p999_ns"], torch["p999_ns"])
+        else:
+            row["p50_ratio"] = row["p99_ratio"] = row["p999_ratio"] = None
+        rows.append(row)
+    return rows
+
+
+def format_p50(p50_ns, status):
+    """有 status 的记录没有计时，显示 status 本身"""
+    if status:
+        return status
+    return "-" if p50_ns is None else p50_ns
+
+
+def print_report(rows):
+    header = (
+        f"{'case':<48} {'paddle p50':>11} {'torch p50':>11} {'p50':>7} "
+        f"{'p99':>7} {'p99.9':>7}"
+    )
+    print(header)
+    print("-" * len(header))
+    current_binary = None
+    for row in rows:
+        if row["binary"] != current_binary:
+            current_binary = row["binary"]
+            print(f"[{current_binary}]")
+        print(
+            f"  {row['name']:<46} "
+            f"{format_p50(row['paddle_p50_ns'], row['paddle_status']):>11} "
+            f"{format_p50(row['torch_p50_ns'], row['torch_status']):>11} "
+            f"{format_ratio(row['p50_ratio']):>7} "
+            f"{format_ratio(row['p99_ratio']):>7} "
+            f"{format_ratio(row['p999_ratio']):>7}"
+        )
+
+
+def check_placement(paddle_results, torch_results):
+    """两框架的线程 / 内存放置不一致时对比没有意义，给出提示"""
+    placements = {}
+    for framework, results in (
+        ("paddle", paddle_results),
+        ("torch", torch_results),
+    ):
+        placements[framework] = {
+            json.dumps(record.get("placement"), sort_keys=True)
+            for record in results.values()
+        }
+    if placements["paddle"] and placements["torch"]:
+        if placements["paddle"] != placements["torch"]:
+            print(
+                "WARNING: paddle / torch placement differs: "
+                f"{sorted(placements['paddle'])} vs "
+                f"{sorted(placements['torch'])}"
+            )
+
+
+def format_value(value, scale, fmt):
+    """非有限值在 JSON 中写为 null，显示为 -"""
+    return "-" if value is None else format(value * scale, fmt)
+
+
+def print_roofline(paddle_results, torch_results):
+    """带 fraction_of_peak 计数器的记录额外输出带宽与峰值占比"""
+    keys = sorted(
+        key
+        for key in set(paddle_results) | set(torch_results)
+        if "fraction_of_peak"
+        in (paddle_results.get(key) or torch_results.get(key))["counters"]
+    )
+    if not keys:
+        return
+    print()
+    header = (
+        f"{'roofline case':<36} {'paddle GB/s':>12} {'peak%':>7} "
+        f"{'torch GB/s':>12} {'peak%':>7}"
+    )
+    print(header)
+    print("-" * len(header))
+    for key in keys:
+        cells = []
+        for results in (paddle_results, torch_results):
+            record = results.get(key)
+            if record is None:
+                cells.append(f"{'-':>12} {'-':>7}")
+                continue
+            counters = record["counters"]
+            bytes_per_s = counters.get("bytes_per_s")
+            fraction = counters.get("fraction_of_peak")
+            cells.append(
+                f"{format_value(bytes_per_s, 1e-9, '.2f'):>12} "
+                f"{format_value(fraction, 1, '.1%'):>7}"
+            )
+        print(f"{key[1]:<36} {' '.join(cells)}")
+
+
+def export_histograms(hist_dir, paddle_results, torch_results):
+    """每个 case 导出一个 CSV：bucket_lo, bucket_hi, paddle, torch"""
+    os.makedirs(hist_dir, exist_ok=True)
+    for key in sorted(set(paddle_results) & set(torch_results)):
+        buckets = {}
+        for column, results in (
+            ("paddle", paddle_results),
+            ("torch", torch_results),
+        ):
+            for lo, hi, count in results[key]["histogram"]["buckets"]:
+                buckets.setdefault((lo, hi), {"paddle": 0, "torch": 0})
+                buckets[(lo, hi)][column] = count
+        safe_name = re.sub(r"[^A-Za-z0-9_.-]+", "_", f"{key[0]}__{key[1]}")
+        path = os.path.join(hist_dir, safe_name + ".csv")
+        with open(path, "w", newline="", encoding="utf-8") as f:
+            writer = csv.writer(f)
+            writer.writerow(["bucket_lo_ns", "bucket_hi_ns", "paddle", "torch"])
+            for (lo, hi), counts in sorted(buckets.items()):
+                writer.writerow([lo, hi, counts["paddle"], counts["torch"]])
+    print(f"Histograms exported to: {hist_dir}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Paddle/Torch 性能对比工具")
+    parser.add_argument("build_path", help="构建目录")
+    parser.add_argument(
+        "--filter", "-f", default=None, help="按二进制名过滤（正则）"
+    )
+    parser.add_argument(
+        "--no-run", action="store_true", help="不运行，仅对比已有结果"
+    )
+    parser.add_argument(
+        "--hist-dir", default=None, help="导出直方图 CSV 的目录"
+    )
+    parser.add_argument("--json", "-j", default=None, help="输出JSON文件")
+    parser.add_argument(
+        "extra_args", nargs="*", help="透传给 benchmark 二进制的参数"
+    )
+    args = parser.parse_args()
+
+    failed = []
+    if not args.no_run:
+        failed = run_benchmarks(args.build_path, args.filter, args.extra_args)
+
+    paddle_results = load_results("paddle", args.filter)
+    torch_results = load_results("torch", args.filter)
+    check_placement(paddle_results, torch_results)
+    rows = compare(paddle_results, torch_results)
+    print_report(rows)
+    print_roofline(paddle_results, torch_results)
+
+    if args.hist_dir:
+        export_histograms(args.hist_dir, paddle_results, torch_results)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(
+                {
+                    "rows": rows,
+                    "paddle": list(paddle_results.values()),
+                    "torch": list(torch_results.values()),
+                },
+                f,
+                indent=2,
+            )
+        print(f"JSON report saved to: {args.json}")
+
+    if failed:
+        print("FAILED: " + ", ".join(os.path.basename(x) for x in failed))
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,359 @@
+#!/usr/bin/env python3
+"""
+compat 二进制体积与符号开销报告
+
+扫描构建目录下的 paddle_* / torch_* 可执行文件（测试与 benchmark），
+对每个二进制记录:
+  - .text 段大小（size -A）
+  - 动态重定位条目数（readelf -r）
+  - 未定义的动态符号数，按 DT_NEEDED 中提供该符号的框架库归类
+    （如 libpaddle.so、libphi.so、libphi_core.so、libphi_gpu.so、
+    libcommon.so、libtorch_cpu.so、libc10.so）
+  - 二进制内联 / 弱定义的模板实例体积，按来源 compat 头文件归类
+    （需要 -g 构建以便 nm -l 给出源文件；无调试信息时按顶层命名空间归类）
+按 paddle_X / torch_X 配对后输出差值排序，定位哪些 compat API 引入了
+大量依赖。
+
+用法:
+    python3 bench/binary_size_report.py <BUILD_PATH> [--filter Item]
+        [--top 20] [--json OUT]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+from collections import Counter
+from concurrent.futures import ThreadPoolExecutor
+
+FRAMEWORKS = ("paddle", "torch")
+# 相对构建目录的二进制目录：测试与 benchmark
+BINARY_DIRS = ("", "bench")
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+# 安装后的头文件位于 .../include/ 或 Paddle 的 .../include/compat/ 下，取最右侧
+# 的根目录之后的相对路径作为键，使两个框架的同名头文件能够配对
+INCLUDE_ROOT_RE = re.compile(r"^.*/(?:include|compat)/")
+HEADER_ROOT_RE = re.compile(r"/((?:ATen|c10|torch|paddle|phi)/.+)$")
+HEADER_PREFIXES = ("ATen/", "c10/", "torch/", "paddle/", "phi/")
+RELOC_COUNT_RE = re.compile(
+    r"Relocation section '([^']+)' at offset \S+ contains (\d+) entr"
+)
+LDD_RE = re.compile(r"^\s*(\S+) => (\S+) \(0x[0-9a-f]+\)$")
+NAMESPACE_RE = re.compile(r"([A-Za-z_]\w*)::")
+# nm 中表示内联函数、模板实例与静态成员的符号类型（弱定义 / GNU unique）
+INLINE_SYMBOL_TYPES = frozenset("WwVvu")
+
+
+def log(msg):
+    """实时日志输出"""
+    print(msg, flush=True)
+
+
+def run(cmd):
+    result = subprocess.run(cmd, capture_output=True, text=True, check=False)
+    return result.stdout
+
+
+def list_binaries(build_path, name_filter):
+    """返回 {(kind, name): {framework: path}}，name 去掉框架前缀"""
+    pairs = {}
+    for sub_dir in BINARY_DIRS:
+        kind = sub_dir or "test"
+        for framework in FRAMEWORKS:
+            exec_path = os.path.join(build_path, sub_dir, framework)
+            if not os.path.isdir(exec_path):
+                continue
+            prefix = framework + "_"
+            for filename in sorted(os.listdir(exec_path)):
+                full_path = os.path.join(exec_path, filename)
+                if not filename.startswith(prefix):
+                    continue
+                if not (
+                    os.path.isfile(full_path) and os.access(full_path, os.X_OK)
+                ):
+                    continue
+                if name_filter and not re.search(name_filter, filename):
+                    continue
+                key = (kind, filename[len(prefix) :])
+                pairs.setdefault(key, {})[framework] = full_path
+    return pairs
+
+
+def text_size(path):
+    for line in run(["size", "-A", path]).splitlines():
+        fields = line.split()
+        if len(fields) >= 2 and fields[0] == ".text":
+            return int(fields[1])
+    return 0
+
+
+def dynamic_relocations(path):
+    """返回 {section: count}，如 .rela.dyn / .rela.plt"""
+    return {
+        section: int(count)
+        for section, count in RELOC_COUNT_RE.findall(
+            run(["readelf", "-rW", path])
+        )
+    }
+
+
+def needed_libraries(path):
+    """通过 ldd 解析 DT_NEEDED 的实际路径，返回 {soname: path}"""
+    libraries = {}
+    for line in run(["ldd", path]).splitlines():
+        match = LDD_RE.match(line)
+        if match and os.path.exists(match.group(2)):
+            libraries[match.group(1)] = match.group(2)
+    return libraries
+
+
+def strip_version(symbol):
+    """去掉 nm 输出中的符号版本后缀，如 foo@GLIBCXX_3.4 / foo@@GLIBC_2.2.5"""
+    return symbol.split("@", 1)[0]
+
+
+def undefined_symbols(path):
+    return {
+        strip_version(symbol)
+        for symbol in run(
+            ["nm", "-D", "--undefined-only", "--format=just-symbols", path]
+        ).split()
+    }
+
+
+_defined_cache = {}
+
+
+def defined_symbols(library_path):
+    """库导出的动态符号，多个二进制共享缓存"""
+    if library_path not in _defined_cache:
+        _defined_cache[library_path] = {
+            strip_version(symbol)
+            for symbol in run(
+                [
+                    "nm",
+                    "-D",
+                    "--defined-only",
+                    "--format=just-symbols",
+                    library_path,
+                ]
+            ).split()
+        }
+    return _defined_cache[library_path]
+
+
+def resolve_undefined(path):
+    """把未定义符号归到第一个导出它的 DT_NEEDED 库，其余记为 <unresolved>"""
+    counts = Counter()
+    libraries = needed_libraries(path)
+    for symbol in undefined_symbols(path):
+        owner = "<unresolved>"
+        for soname, library_path in libraries.items():
+            if symbol in defined_symbols(library_path):
+                owner = soname
+                break
+        counts[owner] += 1
+    return dict(counts)
+
+
+def is_repo_file(source):
+    return os.path.realpath(source).startswith(REPO_ROOT + os.sep)
+
+
+def header_key(source):
+    """去掉头文件路径中 include 根目录之前的部分，如
+    .../torch/include/ATen/core/Tensor.h 与
+    .../paddle/include/compat/ATen/core/Tensor.h 均得到 ATen/core/Tensor.h；
+    不属于框架头文件时返回 None"""
+    relative = INCLUDE_ROOT_RE.sub("", source)
+    if relative != source:
+        return relative if relative.startswith(HEADER_PREFIXES) else None
+    # 源码树中未安装的头文件（无 include 根目录）
+    match = HEADER_ROOT_RE.search(source)
+    return match.group(1) if match else None
+
+
+def inline_bloat(path):
+    """按来源头文件统计弱定义符号体积（字节）"""
+    bloat = Counter()
+    output = run(["nm", "-C", "-S", "-l", "--defined-only", path])
+    for line in output.splitlines():
+        # 地址 大小 类型 名称[\t文件:行号]
+        fields = line.split(" ", 3)
+        if len(fields) < 4 or fields[2] not in INLINE_SYMBOL_TYPES:
+            continue
+        size = int(fields[1], 16)
+        name, _, location = fields[3].partition("\t")
+        source = location.rpartition(":")[0]
+        if source and is_repo_file(source):
+            # 仓库内测试 / benchmark 自身的实例不属于任何 compat 头文件
+            continue
+        origin = header_key(source)
+        if origin is None:
+            namespace = NAMESPACE_RE.search(name)
+            origin = namespace.group(1) + "::*" if namespace else "<other>"
+        bloat[origin] += size
+    return dict(bloat)
+
+
+def measure_binary(path):
+    return {
+        "path": path,
+        "text_bytes": text_size(path),
+        "relocations": dynamic_relocations(path),
+        "undefined_by_library": resolve_undefined(path),
+        "inline_bytes_by_header": inline_bloat(path),
+    }
+
+
+def total_relocations(record):
+    return sum(record["relocations"].values())
+
+
+def rank_pairs(results):
+    """按 paddle - torch 的 .text 差值降序排列配对的二进制"""
+    rows = []
+    for (kind, name), frameworks in results.items():
+        if set(frameworks) != set(FRAMEWORKS):
+            continue
+        paddle = frameworks["paddle"]
+        torch = frameworks["torch"]
+        rows.append(
+            {
+                "kind": kind,
+                "name": name,
+                "text_delta": paddle["text_bytes"] - torch["text_bytes"],
+                "reloc_delta": total_relocations(paddle)
+                - total_relocations(torch),
+                "undefined_delta": sum(paddle["undefined_by_library"].values())
+                - sum(torch["undefined_by_library"].values()),
+                "paddle": paddle,
+                "torch": torch,
+            }
+        )
+    rows.sort(key=lambda r: -r["text_delta"])
+    return rows
+
+
+def rank_headers(results):
+    """汇总所有二进制中各头文件的内联体积，按 paddle - torch 差值排序"""
+    totals = {framework: Counter() for framework in FRAMEWORKS}
+    for frameworks in results.values():
+        for framework, record in frameworks.items():
+            totals[framework].update(record["inline_bytes_by_header"])
+    headers = set(totals["paddle"]) | set(totals["torch"])
+    rows = [
+        {
+            "header": header,
+            "paddle_bytes": totals["paddle"][header],
+            "torch_bytes": totals["torch"][header],
+            "delta": totals["paddle"][header] - totals["torch"][header],
+        }
+        for header in headers
+    ]
+    rows.sort(key=lambda r: -abs(r["delta"]))
+    return rows
+
+
+def library_totals(results):
+    """各框架所有二进制从每个库解析的未定义符号总数"""
+    totals = {framework: Counter() for framework in FRAMEWORKS}
+    for frameworks in results.values():
+        for framework, record in frameworks.items():
+            totals[framework].update(record["undefined_by_library"])
+    return {framework: dict(counts) for framework, counts in totals.items()}
+
+
+def print_report(binary_rows, header_rows, libraries, top):
+    log("=== Binaries (sorted by .text delta, paddle - torch) ===")
+    header = (
+        f"{'binary':<40} {'paddle text':>12} {'torch text':>12} "
+        f"{'Δtext':>10} {'Δreloc':>8} {'Δundef':>8}"
+    )
+    log(header)
+    log("-" * len(header))
+    for row in binary_rows[:top]:
+        log(
+            f"{row['kind'] + '/' + row['name']:<40} "
+            f"{row['paddle']['text_bytes']:>12} "
+            f"{row['torch']['text_bytes']:>12} "
+            f"{row['text_delta']:>10} {row['reloc_delta']:>8} "
+            f"{row['undefined_delta']:>8}"
+        )
+
+    log("\n=== Undefined symbols resolved per library (all binaries) ===")
+    for framework in FRAMEWORKS:
+        for soname, count in sorted(
+            libraries[framework].items(), key=lambda item: -item[1]
+        ):
+            log(f"  [{framework}] {soname:<32} {count:>8}")
+
+    log("\n=== Inlined template bytes per header (|paddle - torch|) ===")
+    header = f"{'header':<56} {'paddle':>10} {'torch':>10} {'delta':>10}"
+    log(header)
+    log("-" * len(header))
+    for row in header_rows[:top]:
+        log(
+            f"{row['header']:<56} {row['paddle_bytes']:>10} "
+            f"{row['torch_bytes']:>10} {row['delta']:>10}"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="compat 二进制体积与符号开销报告"
+    )
+    parser.add_argument("build_path", help="构建目录")
+    parser.add_argument("--filter", default=None, help="二进制名正则过滤")
+    parser.add_argument("--top", type=int, default=20, help="每个表输出的行数")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1)
+    parser.add_argument("--json", "-j", default=None, help="输出JSON文件")
+    args = parser.parse_args()
+
+    pairs = list_binaries(args.build_path, args.filter)
+    if not pairs:
+        log(f"ERROR: 在 {args.build_path} 下未找到 paddle_*/torch_* 二进制")
+        sys.exit(1)
+
+    paths = sorted(
+        {p for frameworks in pairs.values() for p in frameworks.values()}
+    )
+    log(f"分析 {len(paths)} 个二进制...")
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        # 先对所有二进制依赖的库各 nm 一次预热符号缓存，避免多个线程重复
+        # nm 同一个大库
+        libraries = set()
+        for needed in pool.map(needed_libraries, paths):
+            libraries.update(needed.values())
+        list(pool.map(defined_symbols, sorted(libraries)))
+        measured = dict(zip(paths, pool.map(measure_binary, paths)))
+
+    results = {
+        key: {
+            framework: measured[path] for framework, path in frameworks.items()
+        }
+        for key, frameworks in pairs.items()
+    }
+    binary_rows = rank_pairs(results)
+    header_rows = rank_headers(results)
+    libraries = library_totals(results)
+    print_report(binary_rows, header_rows, libraries, args.top)
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(
+                {
+                    "binaries": binary_rows,
+                    "headers": header_rows,
+                    "libraries": libraries,
+                },
+                f,
+                indent=2,
+            )
+        log(f"JSON report saved to: {args.json}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,229 @@
+#include <ATen/ATen.h>
+#include <c10/core/Scalar.h>
+#include <c10/core/ScalarType.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "src/scalar_type_fns.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CanCastFn;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ElementSizeFn;
+using paddle_api_test::IsBinaryTypeFn;
+using paddle_api_test::IsComplexTypeFn;
+using paddle_api_test::IsFloatingTypeFn;
+using paddle_api_test::IsIntegralTypeFn;
+using paddle_api_test::IsReducedFloatingTypeFn;
+using paddle_api_test::PromoteTypesFn;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::ToAccumulateTypeFn;
+
+// 每次计时迭代遍历一遍长度为 kSequenceLength 的输入序列，
+// ns_per_call = p50 / kSequenceLength
+constexpr size_t kSequenceLength = 1024;
+
+// 两端都支持的 dtype，与 ScalarTypeFunctionsTest 覆盖的范围一致
+static const std::vector<c10::ScalarType>& common_types() {
+  static const std::vector<c10::ScalarType> types = {
+      c10::ScalarType::Float,
+      c10::ScalarType::Double,
+      c10::ScalarType::Half,
+      c10::ScalarType::BFloat16,
+      c10::ScalarType::Int,
+      c10::ScalarType::Long,
+      c10::ScalarType::Bool,
+      c10::ScalarType::Byte,
+      c10::ScalarType::Char,
+      c10::ScalarType::Short,
+      c10::ScalarType::ComplexFloat,
+      c10::ScalarType::ComplexDouble};
+  return types;
+}
+
+// 固定种子的伪随机下标序列，两个框架的 mixed 输入完全相同
+static std::vector<size_t> mixed_indices(size_t range, uint64_t seed) {
+  std::vector<size_t> indices(kSequenceLength);
+  uint64_t state = seed;
+  for (size_t& index : indices) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    index = static_cast<size_t>((state >> 33) % range);
+  }
+  return indices;
+}
+
+// 同一函数在两种输入序列上计时：
+//   uniform  每次都是 (Half, Float)，分支总能预测正确
+//   mixed    12 种 dtype 的伪随机序列
+// 查表实现两者耗时相同；switch / if 链在 mixed 上频繁误预测，
+// mixed_vs_uniform 明显大于 1。能否用于常量表达式由
+// ScalarTypeFunctionsTest.ConstexprUsable 记录并经 result_cmp 比对
+template <typename Fn>
+static void run_type_fn(const std::string& api) {
+  const std::vector<c10::ScalarType>& types = common_types();
+  const std::vector<size_t> lhs = mixed_indices(types.size(), 1);
+  const std::vector<size_t> rhs = mixed_indices(types.size(), 2);
+  std::vector<c10::ScalarType> mixed_a(kSequenceLength);
+  std::vector<c10::ScalarType> mixed_b(kSequenceLength);
+  for (size_t i = 0; i < kSequenceLength; ++i) {
+    mixed_a[i] = types[lhs[i]];
+    mixed_b[i] = types[rhs[i]];
+  }
+  const std::vector<c10::ScalarType> uniform_a(kSequenceLength,
+                                               c10::ScalarType::Half);
+  const std::vector<c10::ScalarType> uniform_b(kSequenceLength,
+                                               c10::ScalarType::Float);
+
+  const auto measure = [&](const std::string& input,
+                           const std::vector<c10::ScalarType>& a,
+                           const std::vector<c10::ScalarType>& b) {
+    const Fn fn;
+    return RunBenchmark("scalar_type/" + api + "/" + input, [&] {
+      for (size_t i = 0; i < kSequenceLength; ++i) {
+        if constexpr (IsBinaryTypeFn<Fn>()) {
+          auto value = fn(a[i], b[i]);
+          DoNotOptimize(value);
+        } else {
+          auto value = fn(a[i]);
+          DoNotOptimize(value);
+        }
+      }
+    });
+  };
+  BenchmarkResult uniform = measure("uniform", uniform_a, uniform_b);
+  BenchmarkResult mixed = measure("mixed", mixed_a, mixed_b);
+  const double uniform_ns =
+      static_cast<double>(uniform.histogram.percentile(50)) / kSequenceLength;
+  const double mixed_ns =
+      static_cast<double>(mixed.histogram.percentile(50)) / kSequenceLength;
+  mixed.addCounter("mixed_vs_uniform", mixed_ns / uniform_ns);
+  for (auto* result : {&uniform, &mixed}) {
+    result->addCounter("calls_per_iter",
+                       static_cast<double>(kSequenceLength));
+    result->addCounter(
+        "ns_per_call",
+        static_cast<double>(result->histogram.percentile(50)) /
+            kSequenceLength);
+    result->addLabel("api", api);
+  }
+  uniform.addLabel("input", "uniform");
+  mixed.addLabel("input", "mixed");
+  ReportBenchmark(uniform);
+  ReportBenchmark(mixed);
+}
+
+TEST(ScalarTypeBench, Predicates) {
+  run_type_fn<IsFloatingTypeFn>("isFloatingType");
+  run_type_fn<IsIntegralTypeFn>("isIntegralType");
+  run_type_fn<IsComplexTypeFn>("isComplexType");
+  run_type_fn<IsReducedFloatingTypeFn>("isReducedFloatingType");
+}
+
+TEST(ScalarTypeBench, ElementSize) {
+  run_type_fn<ElementSizeFn>("elementSize");
+}
+
+TEST(ScalarTypeBench, Promotion) {
+  run_type_fn<PromoteTypesFn>("promoteTypes");
+  run_type_fn<CanCastFn>("canCast");
+}
+
+TEST(ScalarTypeBench, AccumulateType) {
+  run_type_fn<ToAccumulateTypeFn>("toAccumulateType");
+}
+
+// c10::Scalar 的转换按内部 tag 分支。uniform 全为 double，mixed 为
+// double / int64 / bool 的伪随机序列；构造的输入为对应 C++ 值
+template <typename T, typename Fn>
+static void run_scalar_op(const std::string& api,
+                          const std::string& input,
+                          const std::vector<T>& inputs,
+                          Fn&& fn) {
+  BenchmarkResult result =
+      RunBenchmark("scalar/" + api + "/" + input, [&] {
+        for (size_t i = 0; i < kSequenceLength; ++i) {
+          auto value = fn(inputs[i]);
+          DoNotOptimize(value);
+        }
+      });
+  result.addCounter("calls_per_iter", static_cast<double>(kSequenceLength));
+  result.addCounter(
+      "ns_per_call",
+      static_cast<double>(result.histogram.percentile(50)) / kSequenceLength);
+  // construct_* 对应构造函数，其余为同名成员函数
+  const std::string method = api.rfind("construct_", 0) == 0 ? "Scalar" : api;
+  result.addLabel("api", "c10::Scalar::" + method);
+  result.addLabel("op", api);
+  result.addLabel("input", input);
+  ReportBenchmark(result);
+}
+
+TEST(ScalarTypeBench, ScalarConversions) {
+  const std::vector<size_t> kinds = mixed_indices(3, 3);
+  std::vector<double> doubles;
+  std::vector<int64_t> ints;
+  std::vector<bool> bools;
+  std::vector<c10::Scalar> uniform;
+  std::vector<c10::Scalar> mixed;
+  uniform.reserve(kSequenceLength);
+  mixed.reserve(kSequenceLength);
+  for (size_t i = 0; i < kSequenceLength; ++i) {
+    doubles.push_back(static_cast<double>(i) + 0.5);
+    ints.push_back(static_cast<int64_t>(i));
+    bools.push_back(i % 2 == 0);
+    uniform.emplace_back(doubles.back());
+    switch (kinds[i]) {
+      case 0:
+        mixed.emplace_back(static_cast<double>(i) + 0.5);
+        break;
+      case 1:
+        mixed.emplace_back(static_cast<int64_t>(i));
+        break;
+      default:
+        mixed.emplace_back(i % 2 == 0);
+        break;
+    }
+  }
+
+  for (const auto& [input, scalars] :
+       {std::make_pair(std::string("uniform"), &uniform),
+        std::make_pair(std::string("mixed"), &mixed)}) {
+    run_scalar_op("to<double>", input, *scalars, [](const c10::Scalar& s) {
+      return s.to<double>();
+    });
+    run_scalar_op("to<int64_t>", input, *scalars, [](const c10::Scalar& s) {
+      return s.to<int64_t>();
+    });
+    run_scalar_op("to<float>", input, *scalars, [](const c10::Scalar& s) {
+      return s.to<float>();
+    });
+    run_scalar_op("type", input, *scalars, [](const c10::Scalar& s) {
+      return s.type();
+    });
+    run_scalar_op("isFloatingPoint",
+                  input,
+                  *scalars,
+                  [](const c10::Scalar& s) { return s.isFloatingPoint(); });
+  }
+
+  run_scalar_op("construct_double", "uniform", doubles, [](double v) {
+    return c10::Scalar(v);
+  });
+  run_scalar_op("construct_int64", "uniform", ints, [](int64_t v) {
+    return c10::Scalar(v);
+  });
+  run_scalar_op("construct_bool", "uniform", bools, [](bool v) {
+    return c10::Scalar(v);
+  });
+}
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,257 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/reshape.h>
+#include <ATen/ops/zeros.h>
+#include <c10/util/ArrayRef.h>
+#include <c10/util/OptionalArrayRef.h>
+#include <gtest/gtest.h>
+
+#if __has_include(<c10/util/SmallVector.h>)
+#include <c10/util/SmallVector.h>
+#define BENCH_HAS_SMALL_VECTOR 1
+#else
+#define BENCH_HAS_SMALL_VECTOR 0
+#endif
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SubtractEmptyCallBaseline;
+
+constexpr int64_t kCallsPerIter = 100;
+constexpr int64_t kAllocationProbeCalls = 1024;
+
+// 注意：所有由花括号列表构造的 ArrayRef 都只作为函数实参出现，
+// initializer_list 的底层数组活到整个表达式结束。把 ArrayRef 存进局部
+// 变量（如 c10::SymIntArrayRef sizes({3, 4})）会在语句结束后悬空，GCC 13
+// -O3 下 FlattenTest 曾因此读到垃圾值，见 doc/mismatch_api_record.md
+
+// 模拟算子读取 sizes 参数；noinline 保证 ArrayRef 真正按调用约定传递
+__attribute__((noinline)) static int64_t consume_sizes(
+    c10::IntArrayRef sizes) {
+  int64_t total = 0;
+  for (int64_t size : sizes) {
+    total += size;
+  }
+  return total;
+}
+
+__attribute__((noinline)) static int64_t consume_optional_sizes(
+    c10::OptionalIntArrayRef sizes) {
+  return sizes.has_value() ? consume_sizes(sizes.value()) : -1;
+}
+
+__attribute__((noinline)) static int64_t consume_sym_sizes(
+    c10::SymIntArrayRef sizes) {
+  int64_t total = 0;
+  for (const c10::SymInt& size : sizes) {
+    total += size.expect_int();
+  }
+  return total;
+}
+
+// 每次计时迭代内调用 kCallsPerIter 次；allocs_per_call 必须为 0，
+// 从任何来源构造 ArrayRef 都不应分配或拷贝元素
+template <typename Fn>
+static void run_arrayref(const std::string& api,
+                         const std::string& source,
+                         int64_t expected,
+                         Fn&& fn) {
+  EXPECT_EQ(fn(), expected) << api << " from " << source;
+  BenchmarkResult result =
+      RunBenchmark("arrayref/" + api + "/" + source, [&] {
+        for (int64_t i = 0; i < kCallsPerIter; ++i) {
+          auto value = fn();
+          DoNotOptimize(value);
+        }
+      });
+  SubtractEmptyCallBaseline(&result);
+  const AllocationStats allocs = CountAllocations(
+      [&] {
+        auto value = fn();
+        DoNotOptimize(value);
+      },
+      kAllocationProbeCalls);
+  result.addCounter("calls_per_iter", static_cast<double>(kCallsPerIter));
+  result.addCounter("ns_per_call",
+                    static_cast<double>(result.histogram.percentile(50)) /
+                        kCallsPerIter);
+  result.addCounter(
+      "allocs_per_call",
+      static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+  result.addLabel("api", api);
+  result.addLabel("source", source);
+  ReportBenchmark(result);
+  EXPECT_EQ(allocs.allocations, 0) << api << " from " << source;
+}
+
+// 按值传递的 ArrayRef 若是两个指针宽的平凡可拷贝类型，x86-64 / AArch64
+// 上就放在寄存器中传递，不产生任何内存拷贝。结果以计数器输出，便于对比
+template <typename Ref>
+static void report_layout(const std::string& api) {
+  BenchmarkResult result("arrayref_layout/" + api);
+  result.addCounter("sizeof", static_cast<double>(sizeof(Ref)));
+  result.addCounter("trivially_copyable",
+                    std::is_trivially_copyable_v<Ref> ? 1.0 : 0.0);
+  result.addLabel("api", api);
+  ReportBenchmark(result);
+}
+
+TEST(ArrayRefBench, Layout) {
+  report_layout<c10::IntArrayRef>("IntArrayRef");
+  report_layout<c10::OptionalIntArrayRef>("OptionalIntArrayRef");
+  report_layout<c10::SymIntArrayRef>("SymIntArrayRef");
+  EXPECT_TRUE(std::is_trivially_copyable_v<c10::IntArrayRef>);
+  EXPECT_EQ(sizeof(c10::IntArrayRef), 2 * sizeof(void*));
+}
+
+// 非花括号来源的 ArrayRef 必须直接指向源容器的存储
+TEST(ArrayRefBench, Conversions) {
+  const std::vector<int64_t> vec = {2, 3, 4, 5};
+  const std::array<int64_t, 4> arr = {2, 3, 4, 5};
+  const int64_t c_array[4] = {2, 3, 4, 5};
+  constexpr int64_t kExpected = 14;
+  EXPECT_EQ(c10::IntArrayRef(vec).data(), vec.data());
+  EXPECT_EQ(c10::IntArrayRef(arr).data(), arr.data());
+
+  run_arrayref("IntArrayRef", "vector", kExpected, [&] {
+    return consume_sizes(vec);
+  });
+  run_arrayref("IntArrayRef", "initializer_list", kExpected, [] {
+    return consume_sizes({2, 3, 4, 5});
+  });
+  run_arrayref("IntArrayRef", "std_array", kExpected, [&] {
+    return consume_sizes(arr);
+  });
+  run_arrayref("IntArrayRef", "c_array", kExpected, [&] {
+    return consume_sizes(c_array);
+  });
+  run_arrayref("IntArrayRef", "pointer_length", kExpected, [&] {
+    return consume_sizes(c10::IntArrayRef(vec.data(), vec.size()));
+  });
+#if BENCH_HAS_SMALL_VECTOR
+  const c10::SmallVector<int64_t, 5> small = {2, 3, 4, 5};
+  EXPECT_EQ(c10::IntArrayRef(small).data(), small.data());
+  run_arrayref("IntArrayRef", "small_vector", kExpected, [&] {
+    return consume_sizes(small);
+  });
+#endif
+
+  run_arrayref("OptionalIntArrayRef", "vector", kExpected, [&] {
+    return consume_optional_sizes(vec);
+  });
+  run_arrayref("OptionalIntArrayRef", "initializer_list", kExpected, [] {
+    return consume_optional_sizes({2, 3, 4, 5});
+  });
+  run_arrayref("OptionalIntArrayRef", "IntArrayRef", kExpected, [&] {
+    return consume_optional_sizes(c10::IntArrayRef(vec));
+  });
+  run_arrayref("OptionalIntArrayRef", "nullopt", -1, [] {
+    return consume_optional_sizes(std::nullopt);
+  });
+
+  const std::vector<c10::SymInt> sym_vec = {2, 3, 4, 5};
+  run_arrayref("SymIntArrayRef", "vector", kExpected, [&] {
+    return consume_sym_sizes(sym_vec);
+  });
+  run_arrayref("SymIntArrayRef", "initializer_list", kExpected, [] {
+    return consume_sym_sizes(
+        {c10::SymInt(2), c10::SymInt(3), c10::SymInt(4), c10::SymInt(5)});
+  });
+}
+
+// 同一个 reshape（连续输入上为视图）在不同 sizes 来源下的开销。
+// extra_allocs_vs_vector 为相对 vector 来源多出的 operator new 次数，
+// 应为 0：ArrayRef 进入算子后不应被额外物化成容器
+TEST(ArrayRefBench, IntoOps) {
+  const at::Tensor x = at::zeros({4, 8}, at::kFloat);
+  const std::vector<int64_t> vec = {8, 4};
+  const std::array<int64_t, 2> arr = {8, 4};
+  const std::vector<c10::SymInt> sym_vec = {8, 4};
+
+  double vector_allocs = 0.0;
+  const auto run_op = [&](const std::string& api,
+                          const std::string& source,
+                          auto&& fn) {
+    const at::Tensor r = fn();
+    EXPECT_EQ(r.sizes().vec(), vec) << api << " from " << source;
+    BenchmarkResult result = RunBenchmark(
+        "arrayref_op/" + api + "/" + source, [&] {
+          at::Tensor value = fn();
+          DoNotOptimize(value);
+        });
+    const AllocationStats allocs = CountAllocations(
+        [&] {
+          at::Tensor value = fn();
+          DoNotOptimize(value);
+        },
+        kAllocationProbeCalls);
+    const double allocs_per_call =
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls;
+    if (api == "reshape" && source == "vector") {
+      vector_allocs = allocs_per_call;
+    }
+    result.addCounter("allocs_per_call", allocs_per_call);
+    result.addCounter("extra_allocs_vs_vector",
+                      allocs_per_call - vector_allocs);
+    result.addLabel("api", api);
+    result.addLabel("source", source);
+    ReportBenchmark(result);
+  };
+
+  run_op("reshape", "vector", [&] { return x.reshape(vec); });
+  run_op("reshape", "initializer_list", [&] { return x.reshape({8, 4}); });
+  run_op("reshape", "std_array", [&] { return x.reshape(arr); });
+#if BENCH_HAS_SMALL_VECTOR
+  const c10::SmallVector<int64_t, 5> small = {8, 4};
+  run_op("reshape", "small_vector", [&] { return x.reshape(small); });
+#endif
+  run_op("reshape_symint", "vector", [&] {
+    return at::reshape_symint(x, sym_vec);
+  });
+  run_op("reshape_symint", "initializer_list", [&] {
+    return at::reshape_symint(x, {8, 4});
+  });
+
+  // sum 的 dim 参数为 OptionalIntArrayRef
+  const std::vector<int64_t> dims = {1};
+  const auto run_sum = [&](const std::string& source, auto&& fn) {
+    BenchmarkResult result = RunBenchmark("arrayref_op/sum/" + source, [&] {
+      at::Tensor value = fn();
+      DoNotOptimize(value);
+    });
+    const AllocationStats allocs = CountAllocations(
+        [&] {
+          at::Tensor value = fn();
+          DoNotOptimize(value);
+        },
+        kAllocationProbeCalls);
+    result.addCounter(
+        "allocs_per_call",
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+    result.addLabel("api", "sum");
+    result.addLabel("source", source);
+    ReportBenchmark(result);
+  };
+  run_sum("vector", [&] { return x.sum(dims); });
+  run_sum("initializer_list", [&] { return x.sum({1}); });
+  run_sum("IntArrayRef", [&] { return x.sum(c10::IntArrayRef(dims)); });
+}
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,191 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <c10/util/BFloat16.h>
+#include <c10/util/Half.h>
+#include <gtest/gtest.h>
+
+#if __has_include(<ATen/Parallel.h>)
+#include <ATen/Parallel.h>
+#define BENCH_HAS_ATEN_PARALLEL 1
+#else
+#define BENCH_HAS_ATEN_PARALLEL 0
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench/common/benchmark.h"
+#include "src/tensor_sweep.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::ClobberMemory;
+using paddle_api_test::DoNotOptimize;
+using paddle_api_test::OptionsForNumel;
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SweepNumels;
+
+// 运行时 CPU 支持的 16 位浮点转换指令（cpuid）：F16C 为 CPUID.1:ECX[29]，
+// AVX512_BF16 为 CPUID.(7,1):EAX[5]。这是机器能力，不代表被测代码用到了
+// 这些指令：scalar_loop 取决于本文件的编译选项，tensor_to 取决于框架
+// kernel 的编译与运行时派发
+static std::string cpu_conversion_features() {
+  std::string features;
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 29)) != 0) {
+    features += "f16c";
+  }
+  if (__get_cpuid_count(7, 1, &eax, &ebx, &ecx, &edx) &&
+      (eax & (1u << 5)) != 0) {
+    features += features.empty() ? "avx512bf16" : "+avx512bf16";
+  }
+#endif
+  return features.empty() ? "none" : features;
+}
+
+struct ConvertCase {
+  at::ScalarType dtype;
+  int64_t numel;
+
+  std::string name() const {
+    return std::string(c10::toString(dtype)) + "_" + std::to_string(numel);
+  }
+};
+
+// 1e4 到 1e7 个元素，1e4 时数据常驻 L1/L2，1e7 时受内存带宽限制
+static std::vector<ConvertCase> convert_cases() {
+  std::vector<ConvertCase> cases;
+  for (at::ScalarType dtype : {at::kHalf, at::kBFloat16}) {
+    for (int64_t numel : SweepNumels({10000, 1000000, 10000000}, 10000000)) {
+      cases.push_back({dtype, numel});
+    }
+  }
+  return cases;
+}
+
+class HalfConvertBench : public ::testing::TestWithParam<ConvertCase> {};
+
+// 两条路径分别测量 narrow（float -> 16 位）与 widen（16 位 -> float）：
+//   scalar_loop  逐元素调用 Low(float) / static_cast<float>(Low)
+//   tensor_to    Tensor::to(dtype)，走框架的 cast kernel。计时期间用
+//                at::set_num_threads(1) 关闭 intra-op 并行，使两条路径
+//                只在向量化上有差别；Paddle compat 没有 ATen/Parallel.h，
+//                按框架默认线程数运行，记录在 intra_op_threads 标签中
+// tensor_to 的 speedup_vs_loop 远大于 1 而 scalar_loop 的 elements_per_s
+// 明显低于带宽上限，说明标量转换没有被向量化。两条路径的结果必须
+// 逐位一致
+template <typename Low>
+static void run_conversion(const ConvertCase& c) {
+  const int64_t n = c.numel;
+  at::Tensor floats = at::empty({n}, at::kFloat);
+  at::Tensor lows = at::empty({n}, c.dtype);
+  at::Tensor widened = at::empty({n}, at::kFloat);
+  float* float_data = static_cast<float*>(floats.data_ptr());
+  Low* low_data = static_cast<Low*>(lows.data_ptr());
+  float* widened_data = static_cast<float*>(widened.data_ptr());
+  // 覆盖 [-757, 757] 的非整数值，两种 16 位格式都需要舍入
+  for (int64_t i = 0; i < n; ++i) {
+    float_data[i] = static_cast<float>(i % 4093 - 2046) * 0.37f;
+  }
+
+  const auto narrow_loop = [&] {
+    for (int64_t i = 0; i < n; ++i) {
+      low_data[i] = Low(float_data[i]);
+    }
+    ClobberMemory();
+  };
+  const auto widen_loop = [&] {
+    for (int64_t i = 0; i < n; ++i) {
+      widened_data[i] = static_cast<float>(low_data[i]);
+    }
+    ClobberMemory();
+  };
+
+  narrow_loop();
+  const at::Tensor narrowed = floats.to(c.dtype);
+  EXPECT_EQ(std::memcmp(narrowed.data_ptr(), low_data, n * sizeof(Low)), 0)
+      << c.name() << " narrow";
+  widen_loop();
+  const at::Tensor widened_by_to = lows.to(at::kFloat);
+  EXPECT_EQ(
+      std::memcmp(widened_by_to.data_ptr(), widened_data, n * sizeof(float)),
+      0)
+      << c.name() << " widen";
+
+  const auto report = [&](const std::string& direction,
+                          const std::string& path,
+                          double loop_p50_ns,
+                          const auto& fn) {
+    BenchmarkResult result = RunBenchmark(
+        "convert/" + c.name() + "/" + direction + "/" + path,
+        fn,
+        OptionsForNumel(n));
+    const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+    result.addCounter("numel", static_cast<double>(n));
+    result.addCounter("elements_per_s", n / (p50_ns * 1e-9));
+    result.addCounter("ns_per_element", p50_ns / n);
+    result.addCounter("bytes_per_s",
+                      n * static_cast<double>(sizeof(float) + sizeof(Low)) /
+                          (p50_ns * 1e-9));
+    if (loop_p50_ns > 0.0) {
+      result.addCounter("speedup_vs_loop", loop_p50_ns / p50_ns);
+    }
+    result.addLabel("api", path);
+    result.addLabel("dtype", c10::toString(c.dtype));
+    result.addLabel("direction", direction);
+    result.addLabel("cpu_features", cpu_conversion_features());
+    result.addLabel("intra_op_threads",
+                    BENCH_HAS_ATEN_PARALLEL ? "1" : "default");
+    ReportBenchmark(result);
+    return p50_ns;
+  };
+
+#if BENCH_HAS_ATEN_PARALLEL
+  const int original_threads = at::get_num_threads();
+  at::set_num_threads(1);
+#endif
+  const double narrow_loop_ns =
+      report("narrow", "scalar_loop", 0.0, narrow_loop);
+  report("narrow", "tensor_to", narrow_loop_ns, [&] {
+    at::Tensor r = floats.to(c.dtype);
+    DoNotOptimize(r);
+  });
+  const double widen_loop_ns = report("widen", "scalar_loop", 0.0, widen_loop);
+  report("widen", "tensor_to", widen_loop_ns, [&] {
+    at::Tensor r = lows.to(at::kFloat);
+    DoNotOptimize(r);
+  });
+#if BENCH_HAS_ATEN_PARALLEL
+  at::set_num_threads(original_threads);
+#endif
+}
+
+TEST_P(HalfConvertBench, Throughput) {
+  const ConvertCase& c = GetParam();
+  if (c.dtype == at::kHalf) {
+    run_conversion<c10::Half>(c);
+  } else {
+    run_conversion<c10::BFloat16>(c);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Sizes,
+    HalfConvertBench,
+    ::testing::ValuesIn(convert_cases()),
+    [](const ::testing::TestParamInfo<ConvertCase>& info) {
+      return info.param.name();
+    });
+
+}  // namespace test
+}  // namespace at
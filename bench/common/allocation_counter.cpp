@@ -0,0 +1,87 @@
+#include "bench/common/allocation_counter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace paddle_api_test {
+
+namespace {
+
+// 计数器必须是常量初始化：operator new 可能在静态构造阶段就被调用。
+// nothrow 版本的默认实现会转调这里替换的版本，无需单独定义
+thread_local AllocationStats t_stats;
+
+void* allocate(std::size_t size) {
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  ++t_stats.allocations;
+  t_stats.bytes += static_cast<int64_t>(size);
+  return ptr;
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t alignment) {
+  const auto align = static_cast<std::size_t>(alignment);
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, std::max(align, sizeof(void*)), size) != 0) {
+    throw std::bad_alloc();
+  }
+  ++t_stats.allocations;
+  t_stats.bytes += static_cast<int64_t>(size);
+  return ptr;
+}
+
+void deallocate(void* ptr) noexcept {
+  if (ptr != nullptr) {
+    ++t_stats.deallocations;
+    std::free(ptr);
+  }
+}
+
+}  // namespace
+
+AllocationStats ThreadAllocationStats() { return t_stats; }
+
+}  // namespace paddle_api_test
+
+using paddle_api_test::allocate;
+using paddle_api_test::allocateAligned;
+using paddle_api_test::deallocate;
+
+void* operator new(std::size_t size) { return allocate(size); }
+
+void* operator new[](std::size_t size) { return allocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+
+namespace paddle_api_test {
+
+// 全局 operator new / delete 被替换为计数版本（bench/common/
+// allocation_counter.cpp，只链接进 benchmark 二进制，正确性测试仍用默认
+// 实现），按线程累计调用次数与字节数。
+// 两框架的 TensorImpl、intrusive_ptr、std::vector / std::string 等 C++ 对象
+// 都经 operator new 分配；直接调用 posix_memalign 的数据缓冲区不计入。
+struct AllocationStats {
+  int64_t allocations = 0;
+  int64_t deallocations = 0;
+  int64_t bytes = 0;
+};
+
+// 当前线程自启动以来的累计值
+AllocationStats ThreadAllocationStats();
+
+// 构造时记录快照，delta() 返回之后本线程新增的分配
+class ScopedAllocationCounter {
+ public:
+  ScopedAllocationCounter() : begin_(ThreadAllocationStats()) {}
+
+  AllocationStats delta() const {
+    const AllocationStats now = ThreadAllocationStats();
+    return {now.allocations - begin_.allocations,
+            now.deallocations - begin_.deallocations,
+            now.bytes - begin_.bytes};
+  }
+
+ private:
+  AllocationStats begin_;
+};
+
+// 连续执行 fn 共 iters 次，返回这期间本线程的分配总量；调用方自行除以
+// iters 得到每次调用的均值，避免整数除法把偶发的分配截断为 0
+template <typename Fn>
+AllocationStats CountAllocations(Fn&& fn, int64_t iters) {
+  ScopedAllocationCounter counter;
+  for (int64_t i = 0; i < iters; ++i) {
+    fn();
+  }
+  return counter.delta();
+}
+
+}  // namespace paddle_api_test
@@ -0,0 +1,382 @@
+#include "bench/common/benchmark.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+#include "src/file_manager.h"
+
+extern paddle_api_test::ThreadSafeParam g_custom_param;
+
+namespace paddle_api_test {
+
+namespace {
+std::string escapeJson(const std::string& str) {
+  std::string out;
+  out.reserve(str.size());
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      default:
+        out += c;
+        break;
+    }
+  }
+  return out;
+}
+
+std::string formatDouble(double value) {
+  if (!std::isfinite(value)) {
+    return "null";
+  }
+  std::ostringstream oss;
+  oss.precision(6);
+  oss << std::fixed << value;
+  return oss.str();
+}
+
+__attribute__((noinline)) void emptyCall() { asm volatile(""); }
+
+std::string currentTestName() {
+  const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+  if (info == nullptr) {
+    return "";
+  }
+  return std::string(info->test_suite_name()) + "." + info->name();
+}
+}  // namespace
+
+size_t LatencyHistogram::bucketIndex(int64_t value) {
+  if (value < kSubBucketCount) {
+    return static_cast<size_t>(std::max<int64_t>(value, 0));
+  }
+  const int msb = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+  const int shift = msb - kSubBucketBits;
+  return static_cast<size_t>((shift + 1) * kSubBucketCount +
+                             ((value >> shift) - kSubBucketCount));
+}
+
+int64_t LatencyHistogram::bucketLowerBound(size_t index) {
+  const int64_t idx = static_cast<int64_t>(index);
+  if (idx < kSubBucketCount) {
+    return idx;
+  }
+  const int64_t shift = idx / kSubBucketCount - 1;
+  return (kSubBucketCount + idx % kSubBucketCount) << shift;
+}
+
+int64_t LatencyHistogram::bucketUpperBound(size_t index) {
+  return bucketLowerBound(index + 1) - 1;
+}
+
+void LatencyHistogram::record(int64_t value_ns) {
+  value_ns = std::max<int64_t>(value_ns, 0);
+  const size_t index = bucketIndex(value_ns);
+  if (index >= counts_.size()) {
+    counts_.resize(index + 1, 0);
+  }
+  ++counts_[index];
+  min_ = count_ == 0 ? value_ns : std::min(min_, value_ns);
+  max_ = std::max(max_, value_ns);
+  sum_ += static_cast<double>(value_ns);
+  ++count_;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  if (other.count_ == 0) {
+    return;
+  }
+  if (other.counts_.size() > counts_.size()) {
+    counts_.resize(other.counts_.size(), 0);
+  }
+  for (size_t i = 0; i < other.counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  sum_ += other.sum_;
+  count_ += other.count_;
+}
+
+double LatencyHistogram::mean() const {
+  return count_ == 0 ? 0.0 : sum_ / static_cast<double>(count_);
+}
+
+int64_t LatencyHistogram::percentile(double p) const {
+  if (count_ == 0) {
+    return 0;
+  }
+  const double clamped = std::min(std::max(p, 0.0), 100.0);
+  const int64_t target = std::max<int64_t>(
+      1,
+      static_cast<int64_t>(
+          std::ceil(clamped / 100.0 * static_cast<double>(count_))));
+  int64_t seen = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    seen += counts_[i];
+    if (seen >= target) {
+      return std::min(bucketUpperBound(i), max_);
+    }
+  }
+  return max_;
+}
+
+std::string LatencyHistogram::toJson() const {
+  std::ostringstream oss;
+  oss << "{\"sub_bucket_bits\":" << kSubBucketBits << ",\"buckets\":[";
+  bool first = true;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    if (counts_[i] == 0) {
+      continue;
+    }
+    if (!first) {
+      oss << ",";
+    }
+    first = false;
+    oss << "[" << bucketLowerBound(i) << "," << bucketUpperBound(i) << ","
+        << counts_[i] << "]";
+  }
+  oss << "]}";
+  return oss.str();
+}
+
+void BenchmarkResult::addCounter(const std::string& key, double value) {
+  counters.emplace_back(key, value);
+}
+
+void BenchmarkResult::addLabel(const std::string& key,
+                               const std::string& value) {
+  labels.emplace_back(key, value);
+}
+
+double BenchmarkResult::counter(const std::string& key,
+                                double default_value) const {
+  for (const auto& item : counters) {
+    if (item.first == key) {
+      return item.second;
+    }
+  }
+  return default_value;
+}
+
+std::string BenchmarkResult::toJson() const {
+  std::ostringstream oss;
+  oss << "{\"framework\":\"" << FrameworkName() << "\"";
+  oss << ",\"test\":\"" << escapeJson(currentTestName()) << "\"";
+  oss << ",\"name\":\"" << escapeJson(name) << "\"";
+  oss << ",\"iterations\":" << iterations;
+  oss << ",\"total_ns\":" << formatDouble(total_ns);
+  oss << ",\"mean_ns\":" << formatDouble(histogram.mean());
+  oss << ",\"min_ns\":" << histogram.min();
+  oss << ",\"p50_ns\":" << histogram.percentile(50.0);
+  oss << ",\"p90_ns\":" << histogram.percentile(90.0);
+  oss << ",\"p99_ns\":" << histogram.percentile(99.0);
+  oss << ",\"p999_ns\":" << histogram.percentile(99.9);
+  oss << ",\"max_ns\":" << histogram.max();
+  oss << ",\"counters\":{";
+  for (size_t i = 0; i < counters.size(); ++i) {
+    oss << (i == 0 ? "" : ",") << "\"" << escapeJson(counters[i].first)
+        << "\":" << formatDouble(counters[i].second);
+  }
+  oss << "},\"labels\":{";
+  for (size_t i = 0; i < labels.size(); ++i) {
+    oss << (i == 0 ? "" : ",") << "\"" << escapeJson(labels[i].first)
+        << "\":\"" << escapeJson(labels[i].second) << "\"";
+  }
+  oss << "},\"placement\":" << BenchmarkPlacement::Get().toJson();
+  oss << ",\"histogram\":" << histogram.toJson() << "}";
+  return oss.str();
+}
+
+const char* FrameworkName() {
+#if USE_PADDLE_API
+  return "paddle";
+#else
+  return "torch";
+#endif
+}
+
+int64_t TimerOverheadNs() {
+  static const int64_t overhead_ns = [] {
+    using Clock = std::chrono::steady_clock;
+    int64_t best = std::numeric_limits<int64_t>::max();
+    for (int i = 0; i < 1000; ++i) {
+      const auto begin = Clock::now();
+      const auto end = Clock::now();
+      best = std::min<int64_t>(
+          best,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+              .count());
+    }
+    return best;
+  }();
+  return overhead_ns;
+}
+
+double EmptyCallBaselineNs() {
+  static const double baseline_ns = [] {
+    void (*volatile fn)() = emptyCall;
+    return RunBenchmark("empty_call", [&] { fn(); }).histogram.mean();
+  }();
+  return baseline_ns;
+}
+
+void SubtractEmptyCallBaseline(BenchmarkResult* result) {
+  const double baseline_ns = EmptyCallBaselineNs();
+  result->addCounter("baseline_ns", baseline_ns);
+  result->addCounter("net_ns",
+                     std::max(0.0, result->histogram.mean() - baseline_ns));
+}
+
+BenchmarkOptions OptionsForNumel(int64_t numel) {
+  BenchmarkOptions options;
+  if (numel >= 100000000) {
+    options.warmup_iters = 1;
+    options.min_iters = 3;
+  } else if (numel >= 10000000) {
+    options.warmup_iters = 1;
+    options.min_iters = 5;
+  } else if (numel >= 1000000) {
+    options.warmup_iters = 2;
+    options.min_iters = 10;
+  }
+  return options;
+}
+
+int MaxBenchmarkThreads() {
+  const char* env = std::getenv("PADDLE_API_BENCH_MAX_THREADS");
+  if (env != nullptr && std::atoi(env) > 0) {
+    return std::atoi(env);
+  }
+  const BenchmarkPlacement& placement = BenchmarkPlacement::Get();
+  if (placement.pinned()) {
+    return static_cast<int>(placement.cpus.size());
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::vector<int> ScalingThreadCounts() {
+  const int max_threads = MaxBenchmarkThreads();
+  std::vector<int> counts;
+  for (int n = 1; n < max_threads; n *= 2) {
+    counts.push_back(n);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+double StreamBandwidth::peak() const {
+  return std::max(copy_bytes_per_s, triad_bytes_per_s);
+}
+
+StreamBandwidth MeasureStreamBandwidth(int64_t numel,
+                                       int num_threads,
+                                       int mem_node) {
+  constexpr int kRepeats = 10;
+  constexpr double kScalar = 3.0;
+  // std::vector 会在本线程上值初始化全部元素，页面随之落在主线程所在
+  // 节点；这里只分配不初始化，由下面的 run_parallel 按线程首次写入
+  std::unique_ptr<double[]> a(new double[numel]);
+  std::unique_ptr<double[]> b(new double[numel]);
+  std::unique_ptr<double[]> c(new double[numel]);
+  const size_t bytes = numel * sizeof(double);
+  const bool bound = mem_node >= 0 &&
+                     BindMemoryToNode(a.get(), bytes, mem_node) &&
+                     BindMemoryToNode(b.get(), bytes, mem_node) &&
+                     BindMemoryToNode(c.get(), bytes, mem_node);
+
+  // 把 [0, numel) 均分给各线程并行执行 kernel(begin, end)，返回墙钟 ns
+  auto run_parallel = [&](auto kernel) {
+    const auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&, t] {
+        ScopedThreadPinning pinning(t);
+        kernel(numel * t / num_threads, numel * (t + 1) / num_threads);
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count());
+  };
+
+  run_parallel([&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      a[i] = 1.0;
+      b[i] = 2.0;
+      c[i] = 0.0;
+    }
+  });
+
+  auto copy = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      c[i] = a[i];
+    }
+  };
+  auto triad = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      a[i] = b[i] + kScalar * c[i];
+    }
+  };
+  double copy_ns = std::numeric_limits<double>::max();
+  double triad_ns = std::numeric_limits<double>::max();
+  for (int repeat = 0; repeat < kRepeats; ++repeat) {
+    copy_ns = std::min(copy_ns, run_parallel(copy));
+    triad_ns = std::min(triad_ns, run_parallel(triad));
+    ClobberMemory();
+  }
+  DoNotOptimize(a[numel / 2]);
+
+  StreamBandwidth bandwidth;
+  bandwidth.threads = num_threads;
+  bandwidth.mem_node = bound ? mem_node : -1;
+  bandwidth.copy_bytes_per_s = 2.0 * sizeof(double) * numel / (copy_ns * 1e-9);
+  bandwidth.triad_bytes_per_s =
+      3.0 * sizeof(double) * numel / (triad_ns * 1e-9);
+  return bandwidth;
+}
+
+void ReportBenchmark(const BenchmarkResult& result) {
+  FileManerger file(g_custom_param.get());
+  file.openAppend();
+  file << result.toJson() << "\n";
+  file.saveFile();
+
+  const auto& hist = result.histogram;
+  char line[256];
+  std::snprintf(line,
+                sizeof(line),
+                "[%s] %-40s iters=%-9lld mean=%.1fns p50=%lldns p99=%lldns "
+                "p99.9=%lldns max=%lldns",
+                FrameworkName(),
+                result.name.c_str(),
+                static_cast<long long>(result.iterations),  // NOLINT
+                hist.mean(),
+                static_cast<long long>(hist.percentile(50.0)),  // NOLINT
+                static_cast<long long>(hist.percentile(99.0)),  // NOLINT
+                static_cast<long long>(hist.percentile(99.9)),  // NOLINT
+                static_cast<long long>(hist.max()));            // NOLINT
+  std::cout << line << std::endl;
+}
+
+}  // namespace paddle_api_test
@@ -0,0 +1,244 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bench/common/benchmark_placement.h"
+
+namespace paddle_api_test {
+
+// 阻止编译器把被测表达式当作死代码消除
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+  asm volatile("" : : "m"(value) : "memory");
+}
+
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+
+// HDR 风格的对数分桶直方图：每个 2 的幂区间再线性细分为
+// 2^kSubBucketBits 个子桶，相对误差不超过 1 / 2^kSubBucketBits。
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 5;
+  static constexpr int64_t kSubBucketCount = int64_t{1} << kSubBucketBits;
+
+  void record(int64_t value_ns);
+  void merge(const LatencyHistogram& other);
+
+  int64_t count() const { return count_; }
+  int64_t min() const { return count_ == 0 ? 0 : min_; }
+  int64_t max() const { return max_; }
+  double mean() const;
+  // p 取值 [0, 100]，返回该分位所在桶的上界（不超过实际最大值）
+  int64_t percentile(double p) const;
+
+  // {"sub_bucket_bits":5,"buckets":[[lo,hi,count],...]}，只输出非空桶
+  std::string toJson() const;
+
+  static size_t bucketIndex(int64_t value);
+  static int64_t bucketLowerBound(size_t index);
+  static int64_t bucketUpperBound(size_t index);
+
+ private:
+  std::vector<int64_t> counts_;
+  int64_t count_ = 0;
+  int64_t min_ = 0;
+  int64_t max_ = 0;
+  double sum_ = 0.0;
+};
+
+struct BenchmarkOptions {
+  int64_t warmup_iters = 16;
+  int64_t min_iters = 64;
+  int64_t max_iters = int64_t{1} << 22;
+  double min_time_s = 0.2;
+};
+
+struct BenchmarkResult {
+  explicit BenchmarkResult(std::string case_name)
+      : name(std::move(case_name)) {}
+
+  void addCounter(const std::string& key, double value);
+  void addLabel(const std::string& key, const std::string& value);
+  // 按 key 查找计数器，不存在时返回 default_value
+  double counter(const std::string& key, double default_value = 0.0) const;
+  std::string toJson() const;
+
+  std::string name;
+  int64_t iterations = 0;
+  double total_ns = 0.0;
+  LatencyHistogram histogram;
+  std::vector<std::pair<std::string, double>> counters;
+  std::vector<std::pair<std::string, std::string>> labels;
+};
+
+// 当前二进制对应的框架名："paddle" 或 "torch"
+const char* FrameworkName();
+
+// 连续两次读取时钟的最小开销，逐次计时时从样本中扣除
+int64_t TimerOverheadNs();
+
+// 空函数（经 volatile 函数指针调用）的逐次计时均值，代表计时框架本身
+// 残余的固定开销；测量纳秒级调用时应从结果中扣除
+double EmptyCallBaselineNs();
+
+// 添加 baseline_ns 与 net_ns（mean - baseline，不小于 0）两个计数器
+void SubtractEmptyCallBaseline(BenchmarkResult* result);
+
+// 按输入元素数缩减预热与最少迭代次数：>= 1e6 元素的单次调用已在
+// 毫秒级，>= 1e8 时单次即数百毫秒，默认的 16 / 64 次会使用例耗时失控
+BenchmarkOptions OptionsForNumel(int64_t numel);
+
+// 常数时间检查：同一 API 在最大规模上的 p50 超过最小规模的
+// kConstantTimeMaxGrowth 倍（外加 kConstantTimeSlackNs 的计时噪声余量）
+// 即判定为随元素数增长。1e8 规模的拷贝或逐元素初始化在毫秒级，与
+// 常数时间调用的百纳秒级相差数个数量级，阈值无需精细调节
+constexpr double kConstantTimeMaxGrowth = 5.0;
+constexpr double kConstantTimeSlackNs = 2000.0;
+
+// 扩展性测试的最大线程数：环境变量 PADDLE_API_BENCH_MAX_THREADS，
+// 未设置时取放置策略中的 CPU 数，再退回 std::thread::hardware_concurrency()
+int MaxBenchmarkThreads();
+
+// 1, 2, 4, ... 直到 MaxBenchmarkThreads()（末项总是最大线程数）
+std::vector<int> ScalingThreadCounts();
+
+// STREAM 风格的内存带宽探针（double 数组，取多次重复中的最短耗时）：
+//   copy  c[i] = a[i]          每元素 16 字节
+//   triad a[i] = b[i] + s*c[i] 每元素 24 字节
+// 每个数组 numel 个元素，应远大于末级缓存；数组按线程分块首次写入，
+// 与各线程后续访问的页保持在同一 NUMA 节点。mem_node >= 0 时改为在首次
+// 写入前用 BindMemoryToNode 把三个数组绑定到该节点，用于在同一进程内
+// 比较本地与远端访存；绑定失败时结果中的 mem_node 为 -1。
+struct StreamBandwidth {
+  int threads = 1;
+  int mem_node = -1;
+  double copy_bytes_per_s = 0.0;
+  double triad_bytes_per_s = 0.0;
+
+  double peak() const;
+};
+
+StreamBandwidth MeasureStreamBandwidth(int64_t numel,
+                                       int num_threads,
+                                       int mem_node = -1);
+
+// 追加一条 JSON 记录到当前二进制的结果文件，并在标准输出打印摘要
+void ReportBenchmark(const BenchmarkResult& result);
+
+// 逐次计时执行 fn，每次迭代都记录进直方图，直到同时满足
+// min_iters 与 min_time_s（或达到 max_iters）。配置了 CPU 列表时，测量
+// 阶段把当前线程绑到第一个 CPU；预热在绑核之前进行，使框架在预热中创建
+// 的 intra-op 线程继承完整的 CPU 列表而不是单个核。
+template <typename Fn>
+BenchmarkResult RunBenchmark(const std::string& name,
+                             Fn&& fn,
+                             const BenchmarkOptions& options = {}) {
+  using Clock = std::chrono::steady_clock;
+  for (int64_t i = 0; i < options.warmup_iters; ++i) {
+    fn();
+  }
+
+  ScopedThreadPinning pinning(0);
+  BenchmarkResult result(name);
+  const int64_t overhead_ns = TimerOverheadNs();
+  const int64_t min_time_ns = static_cast<int64_t>(options.min_time_s * 1e9);
+  int64_t elapsed_ns = 0;
+  while (result.iterations < options.max_iters) {
+    const auto begin = Clock::now();
+    fn();
+    const auto end = Clock::now();
+    const int64_t sample_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count();
+    elapsed_ns += sample_ns;
+    result.histogram.record(
+        sample_ns > overhead_ns ? sample_ns - overhead_ns : 0);
+    ++result.iterations;
+    if (result.iterations >= options.min_iters && elapsed_ns >= min_time_ns) {
+      break;
+    }
+  }
+  result.total_ns = result.histogram.mean() * result.iterations;
+  result.addCounter("timer_overhead_ns", static_cast<double>(overhead_ns));
+  return result;
+}
+
+// 在 num_threads 个线程上同时执行 fn(thread_index)。所有线程预热后在同一
+// 起跑线开始，各自运行满 min_time_s，直方图合并后额外记录墙钟时间与吞吐：
+// ops_per_s 为全部线程的总吞吐，ops_per_s_per_thread 为平均单线程吞吐。
+template <typename Fn>
+BenchmarkResult RunThreadedBenchmark(const std::string& name,
+                                     int num_threads,
+                                     Fn&& fn,
+                                     const BenchmarkOptions& options = {}) {
+  using Clock = std::chrono::steady_clock;
+  const int64_t overhead_ns = TimerOverheadNs();
+  const int64_t min_time_ns = static_cast<int64_t>(options.min_time_s * 1e9);
+  std::vector<LatencyHistogram> histograms(num_threads);
+  std::atomic<int> ready{0};
+  std::atomic<bool> start{false};
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int64_t i = 0; i < options.warmup_iters; ++i) {
+        fn(t);
+      }
+      ScopedThreadPinning pinning(t);
+      ready.fetch_add(1, std::memory_order_release);
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      LatencyHistogram& histogram = histograms[t];
+      int64_t elapsed_ns = 0;
+      for (int64_t iters = 1; iters <= options.max_iters; ++iters) {
+        const auto begin = Clock::now();
+        fn(t);
+        const auto end = Clock::now();
+        const int64_t sample_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+                .count();
+        elapsed_ns += sample_ns;
+        histogram.record(sample_ns > overhead_ns ? sample_ns - overhead_ns
+                                                 : 0);
+        if (iters >= options.min_iters && elapsed_ns >= min_time_ns) {
+          break;
+        }
+      }
+    });
+  }
+  while (ready.load(std::memory_order_acquire) < num_threads) {
+    std::this_thread::yield();
+  }
+  const auto wall_begin = Clock::now();
+  start.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const double wall_ns = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                           wall_begin)
+          .count());
+
+  BenchmarkResult result(name);
+  for (const auto& histogram : histograms) {
+    result.histogram.merge(histogram);
+  }
+  result.iterations = result.histogram.count();
+  result.total_ns = result.histogram.mean() * result.iterations;
+  const double ops_per_s = result.iterations / (wall_ns * 1e-9);
+  result.addCounter("threads", num_threads);
+  result.addCounter("wall_ns", wall_ns);
+  result.addCounter("ops_per_s", ops_per_s);
+  result.addCounter("ops_per_s_per_thread", ops_per_s / num_threads);
+  result.addCounter("timer_overhead_ns", static_cast<double>(overhead_ns));
+  return result;
+}
+
+}  // namespace paddle_api_test
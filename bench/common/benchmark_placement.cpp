@@ -0,0 +1,250 @@
+#include "bench/common/benchmark_placement.h"
+
+#include <gtest/gtest.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace paddle_api_test {
+
+namespace {
+
+// <numaif.h> 属于 libnuma，这里直接使用系统调用避免额外依赖
+constexpr int kMpolBind = 2;
+constexpr unsigned kMpolMfMove = 1 << 1;
+constexpr int kMaxNodes = 1024;
+constexpr size_t kMaskWords = kMaxNodes / (8 * sizeof(unsigned long));  // NOLINT
+
+int envInt(const char* name, int default_value) {
+  const char* env = std::getenv(name);
+  return env != nullptr && *env != '\0' ? std::atoi(env) : default_value;
+}
+
+std::string envString(const char* name) {
+  const char* env = std::getenv(name);
+  return env != nullptr ? env : "";
+}
+
+void nodeMask(int node, unsigned long* mask) {  // NOLINT
+  const size_t bits = 8 * sizeof(mask[0]);
+  for (size_t i = 0; i < kMaskWords; ++i) {
+    mask[i] = 0;
+  }
+  mask[node / bits] |= 1UL << (node % bits);
+}
+
+bool setMemoryPolicy(int node) {
+  unsigned long mask[kMaskWords];  // NOLINT
+  nodeMask(node, mask);
+  return syscall(SYS_set_mempolicy, kMpolBind, mask, kMaxNodes + 1) == 0;
+}
+
+std::string formatCpuList(const std::vector<int>& cpus) {
+  std::ostringstream oss;
+  for (size_t i = 0; i < cpus.size();) {
+    size_t j = i;
+    while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+      ++j;
+    }
+    oss << (i == 0 ? "" : ",") << cpus[i];
+    if (j > i) {
+      oss << "-" << cpus[j];
+    }
+    i = j + 1;
+  }
+  return oss.str();
+}
+
+BenchmarkPlacement resolvePlacement() {
+  BenchmarkPlacement placement;
+  const std::string mode = envString("PADDLE_API_BENCH_NUMA");
+  if (mode == "local" || mode == "cross") {
+    placement.mode = mode;
+    placement.cpu_node = envInt("PADDLE_API_BENCH_CPU_NODE", 0);
+    placement.cpus = NumaNodeCpus(placement.cpu_node);
+    placement.mem_node = mode == "local" ? placement.cpu_node
+                                         : RemoteNumaNode(placement.cpu_node);
+    if (mode == "cross" && placement.mem_node < 0) {
+      std::cerr << "[placement] cross mode needs 2+ online NUMA nodes, found "
+                << NumaOnlineNodes().size() << "; falling back to local"
+                << std::endl;
+      placement.mode = "local";
+      placement.mem_node = placement.cpu_node;
+    }
+  }
+  const std::string cpus = envString("PADDLE_API_BENCH_CPUS");
+  if (!cpus.empty()) {
+    placement.cpus = ParseCpuList(cpus);
+    if (placement.mode == "default") {
+      placement.mode = "custom";
+    }
+  }
+  const int mem_node = envInt("PADDLE_API_BENCH_MEM_NODE", -1);
+  if (mem_node >= 0) {
+    placement.mem_node = mem_node;
+    if (placement.mode == "default") {
+      placement.mode = "custom";
+    }
+  }
+  return placement;
+}
+
+// 在任何测试创建 tensor 之前，把进程的 CPU 掩码限制到配置的 CPU 列表并
+// 设置内存策略；之后创建的线程（包括框架的 intra-op 线程池）都会继承。
+// 本文件只链接进 benchmark，正确性测试不会注册该环境
+class PlacementEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override {
+    const BenchmarkPlacement& placement = BenchmarkPlacement::Get();
+    if (placement.mode == "default") {
+      return;
+    }
+    if (placement.pinned()) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      for (int cpu : placement.cpus) {
+        CPU_SET(cpu, &set);
+      }
+      if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        std::cerr << "[placement] sched_setaffinity failed" << std::endl;
+      }
+    }
+    if (placement.mem_node >= 0 && !setMemoryPolicy(placement.mem_node)) {
+      std::cerr << "[placement] set_mempolicy(node " << placement.mem_node
+                << ") failed" << std::endl;
+    }
+    std::cout << "[placement] " << placement.toJson() << std::endl;
+  }
+};
+
+const bool g_placement_registered = [] {
+  ::testing::AddGlobalTestEnvironment(new PlacementEnvironment());
+  return true;
+}();
+
+}  // namespace
+
+const BenchmarkPlacement& BenchmarkPlacement::Get() {
+  static const BenchmarkPlacement placement = resolvePlacement();
+  return placement;
+}
+
+int BenchmarkPlacement::cpuFor(int index) const {
+  return cpus.empty() ? -1 : cpus[index % cpus.size()];
+}
+
+std::string BenchmarkPlacement::toJson() const {
+  std::ostringstream oss;
+  oss << "{\"mode\":\"" << mode << "\",\"cpus\":\"" << formatCpuList(cpus)
+      << "\",\"cpu_node\":" << cpu_node << ",\"mem_node\":" << mem_node
+      << "}";
+  return oss.str();
+}
+
+ScopedThreadPinning::ScopedThreadPinning(int index) {
+  const BenchmarkPlacement& placement = BenchmarkPlacement::Get();
+  if (!placement.pinned()) {
+    return;
+  }
+  cpu_set_t saved;
+  if (sched_getaffinity(0, sizeof(saved), &saved) != 0) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(placement.cpuFor(index), &set);
+  if (sched_setaffinity(0, sizeof(set), &set) == 0) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&saved);
+    saved_mask_.assign(bytes, bytes + sizeof(saved));
+    restore_ = true;
+  }
+}
+
+ScopedThreadPinning::~ScopedThreadPinning() {
+  if (restore_) {
+    sched_setaffinity(0,
+                      saved_mask_.size(),
+                      reinterpret_cast<const cpu_set_t*>(saved_mask_.data()));
+  }
+}
+
+bool BindMemoryToNode(const void* data, size_t bytes, int node) {
+  if (data == nullptr || bytes == 0 || node < 0) {
+    return false;
+  }
+  const auto page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(data) & ~(page - 1);
+  const auto end = reinterpret_cast<uintptr_t>(data) + bytes;
+  unsigned long mask[kMaskWords];  // NOLINT
+  nodeMask(node, mask);
+  return syscall(SYS_mbind,
+                 begin,
+                 end - begin,
+                 kMpolBind,
+                 mask,
+                 kMaxNodes + 1,
+                 kMpolMfMove) == 0;
+}
+
+int RemoteNumaNode(int cpu_node) {
+  const std::vector<int> nodes = NumaOnlineNodes();
+  if (nodes.size() < 2) {
+    return -1;
+  }
+  for (int node : nodes) {
+    if (node > cpu_node) {
+      return node;
+    }
+  }
+  return nodes.front() != cpu_node ? nodes.front() : nodes[1];
+}
+
+std::vector<int> NumaOnlineNodes() {
+  // possible 还包含未上线（无 CPU / 内存）的节点，绑定到这类节点时
+  // set_mempolicy 会失败
+  std::ifstream online("/sys/devices/system/node/online");
+  std::string text;
+  if (!(online >> text)) {
+    return {0};
+  }
+  const std::vector<int> nodes = ParseCpuList(text);
+  return nodes.empty() ? std::vector<int>{0} : nodes;
+}
+
+std::vector<int> NumaNodeCpus(int node) {
+  std::ifstream cpulist("/sys/devices/system/node/node" +
+                        std::to_string(node) + "/cpulist");
+  std::string text;
+  if (!(cpulist >> text)) {
+    return {};
+  }
+  return ParseCpuList(text);
+}
+
+std::vector<int> ParseCpuList(const std::string& text) {
+  std::vector<int> cpus;
+  std::stringstream ss(text);
+  std::string range;
+  while (std::getline(ss, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const size_t dash = range.find('-');
+    const int first = std::atoi(range.substr(0, dash).c_str());
+    const int last = dash == std::string::npos
+                         ? first
+                         : std::atoi(range.substr(dash + 1).c_str());
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+}  // namespace paddle_api_test
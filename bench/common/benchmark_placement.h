@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace paddle_api_test {
+
+// benchmark 的线程与内存放置，由环境变量配置，进程内只解析一次：
+//   PADDLE_API_BENCH_NUMA      local | cross。local 把线程与内存都放在
+//                              CPU 节点上；cross 把内存绑到另一个节点，
+//                              用于测量远端访存惩罚
+//   PADDLE_API_BENCH_CPU_NODE  local / cross 模式下线程所在节点，默认 0
+//   PADDLE_API_BENCH_CPUS      显式 CPU 列表，如 "0-3,8"，优先于节点推导
+//   PADDLE_API_BENCH_MEM_NODE  显式内存节点（set_mempolicy MPOL_BIND）
+// 全部未设置时不做任何绑定。
+struct BenchmarkPlacement {
+  std::string mode = "default";
+  std::vector<int> cpus;  // 为空表示不绑核
+  int cpu_node = -1;
+  int mem_node = -1;  // -1 表示不设置内存策略
+
+  static const BenchmarkPlacement& Get();
+
+  bool pinned() const { return !cpus.empty(); }
+  // 第 index 个线程使用的 CPU：cpus[index % cpus.size()]
+  int cpuFor(int index) const;
+  // {"mode":"cross","cpus":"0-3","cpu_node":0,"mem_node":1}
+  std::string toJson() const;
+};
+
+// 把当前线程绑定到 BenchmarkPlacement::Get().cpuFor(index)；未配置 CPU
+// 列表时什么也不做。RAII 形式在析构时恢复原先的亲和性掩码。
+class ScopedThreadPinning {
+ public:
+  explicit ScopedThreadPinning(int index);
+  ~ScopedThreadPinning();
+
+  ScopedThreadPinning(const ScopedThreadPinning&) = delete;
+  ScopedThreadPinning& operator=(const ScopedThreadPinning&) = delete;
+
+ private:
+  bool restore_ = false;
+  std::vector<unsigned char> saved_mask_;
+};
+
+// 通过 mbind(MPOL_BIND | MPOL_MF_MOVE) 把 [data, data + bytes) 所在的页
+// 迁移到 node，供放置策略生效前已经分配的 buffer 使用
+bool BindMemoryToNode(const void* data, size_t bytes, int node);
+
+// cross 模式的远端节点：cpu_node 之后的下一个在线节点（编号可能不连续，
+// 没有更大的编号时回绕到第一个），在线节点不足两个时返回 -1
+int RemoteNumaNode(int cpu_node);
+
+// /sys/devices/system/node/online 中的在线节点（读取失败时为 {0}）与
+// 各节点的 CPU 列表
+std::vector<int> NumaOnlineNodes();
+std::vector<int> NumaNodeCpus(int node);
+
+// 解析 "0-3,8" 形式的 CPU 列表
+std::vector<int> ParseCpuList(const std::string& text);
+
+}  // namespace paddle_api_test
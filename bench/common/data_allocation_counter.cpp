@@ -0,0 +1,70 @@
+#include "bench/common/data_allocation_counter.h"
+
+#include <ATen/ATen.h>
+#include <ATen/ops/empty.h>
+#include <c10/core/Allocator.h>
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+
+namespace paddle_api_test {
+
+namespace {
+
+// 大 tensor 的计算可能在 intra-op 线程上分配临时缓冲区，计数按进程累计
+std::atomic<int64_t> g_data_allocations{0};
+std::atomic<int64_t> g_data_bytes{0};
+
+class CountingCpuAllocator final : public c10::Allocator {
+ public:
+  explicit CountingCpuAllocator(c10::Allocator* inner) : inner_(inner) {}
+
+  c10::DataPtr allocate(size_t n) override {
+    g_data_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_data_bytes.fetch_add(static_cast<int64_t>(n), std::memory_order_relaxed);
+    return inner_->allocate(n);
+  }
+
+  void copy_data(void* dest,
+                 const void* src,
+                 std::size_t count) const override {
+    inner_->copy_data(dest, src, count);
+  }
+
+ private:
+  c10::Allocator* inner_;
+};
+
+bool install() {
+  c10::Allocator* inner = c10::GetAllocator(c10::DeviceType::CPU);
+  if (inner == nullptr) {
+    return false;
+  }
+  static CountingCpuAllocator counting(inner);
+  c10::SetAllocator(c10::DeviceType::CPU,
+                    &counting,
+                    std::numeric_limits<uint8_t>::max());
+
+  constexpr int64_t kProbeNumel = 1024;
+  const AllocationStats before = DataAllocationStats();
+  at::Tensor probe = at::empty({kProbeNumel}, at::kFloat);
+  const AllocationStats after = DataAllocationStats();
+  return after.bytes - before.bytes >=
+         kProbeNumel * static_cast<int64_t>(sizeof(float));
+}
+
+}  // namespace
+
+bool InstallDataAllocationCounter() {
+  static const bool active = install();
+  return active;
+}
+
+AllocationStats DataAllocationStats() {
+  return {g_data_allocations.load(std::memory_order_relaxed),
+          0,
+          g_data_bytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace paddle_api_test
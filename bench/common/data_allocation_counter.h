@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+
+#include "bench/common/allocation_counter.h"
+
+namespace paddle_api_test {
+
+// tensor 数据缓冲区计数：在 CPU 上以最高优先级注册一个转发到原 allocator
+// 的计数 allocator（c10::SetAllocator），统计所有线程经
+// c10::GetAllocator(kCPU) 申请存储的次数与字节数。释放走原 allocator
+// 返回的 deleter，deallocations 恒为 0。
+//
+// 首次调用时安装，并用一次 at::empty 校准：若框架的 tensor 存储不经过
+// c10 allocator 分配（计数没有变化），返回 false，调用方应把数据分配量
+// 视为不可测，而不是当作 0
+bool InstallDataAllocationCounter();
+
+// 安装以来所有线程的累计值
+AllocationStats DataAllocationStats();
+
+// 连续执行 fn 共 iters 次，返回这期间的数据分配总量
+template <typename Fn>
+AllocationStats CountDataAllocations(Fn&& fn, int64_t iters) {
+  const AllocationStats begin = DataAllocationStats();
+  for (int64_t i = 0; i < iters; ++i) {
+    fn();
+  }
+  const AllocationStats end = DataAllocationStats();
+  return {end.allocations - begin.allocations, 0, end.bytes - begin.bytes};
+}
+
+}  // namespace paddle_api_test
@@ -0,0 +1,28 @@
+#pragma once
+#include <torch/library.h>
+
+#include <stdexcept>
+#include <string>
+
+namespace paddle_api_test {
+
+#if USE_PADDLE_API
+// Paddle compat 没有 Dispatcher：TORCH_LIBRARY / Library::impl 把内核以
+// CppFunction 存入 OperatorRegistry。这里按限定名查一次注册表并返回其中
+// 保存的内核（impl 未指定 dispatch key 时按 CPU 注册），调用方在计时前
+// 取得引用，计时内只包含 CppFunction 的调用
+inline const torch::CppFunction& RegisteredKernel(
+    const std::string& qualified_name) {
+  auto* op = torch::OperatorRegistry::instance().find_operator(qualified_name);
+  if (op == nullptr) {
+    throw std::runtime_error(qualified_name + " is not registered");
+  }
+  const auto it = op->implementations.find(c10::DispatchKey::CPU);
+  if (it == op->implementations.end()) {
+    throw std::runtime_error(qualified_name + " has no CPU kernel");
+  }
+  return it->second;
+}
+#endif
+
+}  // namespace paddle_api_test
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""
+compat 头文件编译开销报告
+
+扫描 test/ 与 bench/ 中以尖括号引用的框架头文件（ATen/、c10/、torch/），
+对每个头文件分别在 Torch 与 Paddle 的 include 树下编译一个只包含该头文件
+的最小翻译单元，记录:
+  - 预处理后的字节数与行数（-E）
+  - 解析耗时（-fsyntax-only 的墙钟时间，取多次最小值；--jobs 大于 1 时
+    并发编译会互相争抢 CPU 与内存带宽，墙钟时间偏大，默认串行）
+  - 模板实例化耗时（clang: -ftime-trace；gcc: -ftime-report）
+并按 Paddle 相对 Torch 的解析耗时排序输出。
+
+用法:
+    python3 bench/compile_time_report.py --compiler g++ \\
+        --torch-include <dir> [<dir> ...] --paddle-include <dir> [<dir> ...] \\
+        [--repeat 3] [--jobs 4] [--json OUT]
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT = os.path.dirname(SCRIPT_DIR)
+HEADER_PREFIXES = ("ATen/", "c10/", "torch/")
+INCLUDE_RE = re.compile(r"^\s*#\s*include\s*<([^>]+)>", re.MULTILINE)
+GCC_TEMPLATE_RE = re.compile(
+    r"^\s*template instantiation\s*:\s*[\d.]+\s*\([^)]*\)\s*[\d.]+\s*"
+    r"\([^)]*\)\s*([\d.]+)",
+    re.MULTILINE,
+)
+CLANG_TEMPLATE_EVENTS = ("InstantiateClass", "InstantiateFunction")
+
+
+def log(msg):
+    """实时日志输出"""
+    print(msg, flush=True)
+
+
+def collect_headers(source_dirs):
+    """收集源码中引用的框架头文件"""
+    headers = set()
+    for source_dir in source_dirs:
+        for root, _, files in os.walk(source_dir):
+            for name in files:
+                if not name.endswith((".cpp", ".h")):
+                    continue
+                with open(
+                    os.path.join(root, name), encoding="utf-8", errors="ignore"
+                ) as f:
+                    for header in INCLUDE_RE.findall(f.read()):
+                        if header.startswith(HEADER_PREFIXES):
+                            headers.add(header)
+    return sorted(headers)
+
+
+def is_clang(compiler):
+    output = subprocess.run(
+        [compiler, "--version"], capture_output=True, text=True, check=False
+    ).stdout
+    return "clang" in output
+
+
+def base_command(compiler, include_dirs, defines):
+    cmd = [compiler, "-std=c++17", "-D_GLIBCXX_USE_CXX11_ABI=1"]
+    cmd += [f"-D{d}" for d in defines]
+    cmd += [f"-I{d}" for d in include_dirs]
+    return cmd
+
+
+def template_instantiation_seconds(cmd, tu_path, work_dir, clang):
+    """返回模板实例化耗时（秒），无法获取时返回 None"""
+    if clang:
+        obj_path = os.path.join(work_dir, "tu.o")
+        subprocess.run(
+            [*cmd, "-ftime-trace", "-c", tu_path, "-o", obj_path],
+            capture_output=True,
+            check=False,
+        )
+        trace_path = os.path.splitext(obj_path)[0] + ".json"
+        if not os.path.exists(trace_path):
+            return None
+        with open(trace_path, encoding="utf-8") as f:
+            trace = json.load(f)
+        total_us = sum(
+            event.get("dur", 0)
+            for event in trace.get("traceEvents", [])
+            if event.get("name") in CLANG_TEMPLATE_EVENTS
+        )
+        return total_us / 1e6
+    result = subprocess.run(
+        [*cmd, "-fsyntax-only", "-ftime-report", tu_path],
+        capture_output=True,
+        text=True,
+        check=False,
+    )
+    match = GCC_TEMPLATE_RE.search(result.stderr)
+    return float(match.group(1)) if match else None
+
+
+def measure_header(header, compiler, include_dirs, defines, repeat, clang):
+    """编译只包含 header 的翻译单元并记录各项开销"""
+    cmd = base_command(compiler, include_dirs, defines)
+    with tempfile.TemporaryDirectory() as work_dir:
+        tu_path = os.path.join(work_dir, "tu.cpp")
+        with open(tu_path, "w", encoding="utf-8") as f:
+            f.write(f"#include <{header}>\n")
+
+        preprocessed = subprocess.run(
+            [*cmd, "-E", tu_path], capture_output=True, check=False
+        )
+        if preprocessed.returncode != 0:
+            return {
+                "ok": False,
+                "error": preprocessed.stderr.decode(errors="ignore")[-500:],
+            }
+
+        parse_seconds = None
+        for _ in range(repeat):
+            begin = time.perf_counter()
+            subprocess.run(
+                [*cmd, "-fsyntax-only", tu_path],
+                capture_output=True,
+                check=False,
+            )
+            elapsed = time.perf_counter() - begin
+            if parse_seconds is None or elapsed < parse_seconds:
+                parse_seconds = elapsed
+
+        return {
+            "ok": True,
+            "preprocessed_bytes": len(preprocessed.stdout),
+            "preprocessed_lines": preprocessed.stdout.count(b"\n"),
+            "parse_seconds": parse_seconds,
+            "template_seconds": template_instantiation_seconds(
+                cmd, tu_path, work_dir, clang
+            ),
+        }
+
+
+def measure_tree(label, headers, args, include_dirs, defines, clang):
+    log(f"[{label}] 编译 {len(headers)} 个头文件...")
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = {
+            header: pool.submit(
+                measure_header,
+                header,
+                args.compiler,
+                include_dirs,
+                defines,
+                args.repeat,
+                clang,
+            )
+            for header in headers
+        }
+        return {header: future.result() for header, future in futures.items()}
+
+
+def ratio(paddle_value, torch_value):
+    if paddle_value is None or not torch_value:
+        return None
+    return paddle_value / torch_value
+
+
+def build_rows(headers, torch_results, paddle_results):
+    rows = []
+    for header in headers:
+        torch = torch_results[header]
+        paddle = paddle_results[header]
+        row = {"header": header, "torch": torch, "paddle": paddle}
+        if torch["ok"] and paddle["ok"]:
+            row["parse_ratio"] = ratio(
+                paddle["parse_seconds"], torch["parse_seconds"]
+            )
+            row["size_ratio"] = ratio(
+                paddle["preprocessed_bytes"], torch["preprocessed_bytes"]
+            )
+            row["template_ratio"] = ratio(
+                paddle["template_seconds"], torch["template_seconds"]
+            )
+        rows.append(row)
+    # 两边都能编译的按解析耗时比值降序，其余排在最后
+    rows.sort(
+        key=lambda r: (
+            r.get("parse_ratio") is None,
+            -(r.get("parse_ratio") or 0.0),
+        )
+    )
+    return rows
+
+
+def format_value(value, fmt):
+    return "-" if value is None else format(value, fmt)
+
+
+def print_report(rows):
+    header = (
+        f"{'header':<40} {'torch KB':>9} {'paddle KB':>9} {'torch s':>8} "
+        f"{'paddle s':>8} {'parse':>7} {'tmpl':>7}"
+    )
+    log(header)
+    log("-" * len(header))
+    for row in rows:
+        torch = row["torch"]
+        paddle = row["paddle"]
+        if not (torch["ok"] and paddle["ok"]):
+            missing = "torch" if not torch["ok"] else "paddle"
+            log(f"{row['header']:<40} FAILED ({missing})")
+            continue
+        log(
+            f"{row['header']:<40} "
+            f"{torch['preprocessed_bytes'] / 1024:>9.0f} "
+            f"{paddle['preprocessed_bytes'] / 1024:>9.0f} "
+            f"{torch['parse_seconds']:>8.2f} "
+            f"{paddle['parse_seconds']:>8.2f} "
+            f"{format_value(row['parse_ratio'], '.2f'):>6}x "
+            f"{format_value(row['template_ratio'], '.2f'):>6}x"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(description="compat 头文件编译开销报告")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--torch-include", nargs="+", required=True)
+    parser.add_argument("--paddle-include", nargs="+", required=True)
+    parser.add_argument(
+        "--paddle-define", action="append", default=[], help="Paddle 额外宏"
+    )
+    parser.add_argument(
+        "--source-dir",
+        action="append",
+        default=None,
+        help="扫描头文件引用的目录，默认 test/ 与 bench/",
+    )
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument(
+        "--jobs", type=int, default=1, help="并发编译数，大于 1 时解析耗时偏大"
+    )
+    parser.add_argument("--json", "-j", default=None, help="输出JSON文件")
+    args = parser.parse_args()
+
+    source_dirs = args.source_dir or [
+        os.path.join(REPO_ROOT, "test"),
+        os.path.join(REPO_ROOT, "bench"),
+    ]
+    headers = collect_headers(source_dirs)
+    if not headers:
+        log("ERROR: 未找到任何框架头文件引用")
+        sys.exit(1)
+
+    clang = is_clang(args.compiler)
+    log(f"编译器: {args.compiler} ({'clang' if clang else 'gcc'})")
+    torch_results = measure_tree(
+        "torch", headers, args, args.torch_include, [], clang
+    )
+    paddle_results = measure_tree(
+        "paddle",
+        headers,
+        args,
+        args.paddle_include,
+        args.paddle_define,
+        clang,
+    )
+    rows = build_rows(headers, torch_results, paddle_results)
+    print_report(rows)
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump({"compiler": args.compiler, "rows": rows}, f, indent=2)
+        log(f"JSON report saved to: {args.json}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+// Time-to-first-op 探针：不链接 gtest 与 src/，只链接框架库，避免测试
+// 框架自身的静态初始化干扰启动耗时。由 bench/startup_bench.py 启动，
+// 以一行 JSON 向 stdout 输出各阶段的 CLOCK_MONOTONIC 绝对时间戳（ns），
+// 驱动脚本用 exec 前记录的时间戳计算各阶段耗时。
+#include <ATen/ATen.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/ones.h>
+#if USE_PADDLE_API
+#include "paddle/extension.h"
+#endif
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include <time.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+int64_t monotonicNs() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+// 可执行文件内优先级最高的构造函数：此时所有依赖的共享库已完成加载、
+// 重定位及其静态构造
+int64_t g_first_ctor_ns = 0;
+__attribute__((constructor(101))) void recordFirstCtor() {
+  g_first_ctor_ns = monotonicNs();
+}
+
+// glibc 在 x86_64 上以 TSC 周期报告 LD_DEBUG=statistics，
+// 驱动脚本需要 TSC 频率把它换算成纳秒；其他架构返回 0
+double calibrateTscHz() {
+#if defined(__x86_64__)
+  const int64_t begin_ns = monotonicNs();
+  const uint64_t begin_tsc = __rdtsc();
+  timespec interval = {0, 20000000};
+  nanosleep(&interval, nullptr);
+  const uint64_t end_tsc = __rdtsc();
+  const int64_t end_ns = monotonicNs();
+  return static_cast<double>(end_tsc - begin_tsc) * 1e9 /
+         static_cast<double>(end_ns - begin_ns);
+#else
+  return 0.0;
+#endif
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {  // NOLINT
+  const int64_t main_ns = monotonicNs();
+
+  // 首次分配：CPU allocator 初始化 + empty 的首次分发
+  const int64_t alloc_begin_ns = monotonicNs();
+  at::Tensor scratch = at::empty({2, 3, 4}, at::kFloat);
+  const int64_t alloc_end_ns = monotonicNs();
+
+  // 与 TensorTest::SetUp 相同的首个算子
+  const int64_t ones_begin_ns = monotonicNs();
+  at::Tensor tensor = at::ones({2, 3, 4}, at::kFloat);
+  const int64_t ones_end_ns = monotonicNs();
+
+  // 预热后的同一调用，作为首次调用额外开销的参照
+  const int64_t steady_begin_ns = monotonicNs();
+  at::Tensor steady = at::ones({2, 3, 4}, at::kFloat);
+  const int64_t steady_end_ns = monotonicNs();
+
+  if (tensor.numel() != 24 || scratch.numel() != 24 || steady.numel() != 24) {
+    std::fprintf(stderr, "unexpected tensor shape\n");
+    return 1;
+  }
+
+  const bool want_tsc = argc > 1 && std::strcmp(argv[1], "--tsc") == 0;
+  const double tsc_hz = want_tsc ? calibrateTscHz() : 0.0;
+
+  std::printf(
+      "{\"framework\":\"%s\",\"first_ctor_ns\":%lld,\"main_ns\":%lld,"
+      "\"alloc_begin_ns\":%lld,\"alloc_end_ns\":%lld,"
+      "\"ones_begin_ns\":%lld,\"ones_end_ns\":%lld,"
+      "\"steady_ones_ns\":%lld,\"tsc_hz\":%.0f}\n",
+#if USE_PADDLE_API
+      "paddle",
+#else
+      "torch",
+#endif
+      static_cast<long long>(g_first_ctor_ns),     // NOLINT
+      static_cast<long long>(main_ns),             // NOLINT
+      static_cast<long long>(alloc_begin_ns),      // NOLINT
+      static_cast<long long>(alloc_end_ns),        // NOLINT
+      static_cast<long long>(ones_begin_ns),       // NOLINT
+      static_cast<long long>(ones_end_ns),         // NOLINT
+      static_cast<long long>(steady_end_ns - steady_begin_ns),  // NOLINT
+      tsc_hz);
+  return 0;
+}
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""
+Time-to-first-op 启动耗时对比
+
+反复启动 <BUILD_PATH>/bench/{paddle,torch}/<fw>_first_op_startup，以 exec 前
+记录的 CLOCK_MONOTONIC 时间戳为起点，结合探针输出的各阶段时间戳拆分:
+  - library_load   动态链接器加载与重定位（LD_DEBUG=statistics，单独一次
+                   运行得到）
+  - exec_to_first_ctor
+                   exec 到可执行文件首个构造函数（探针的 first_ctor_ns），
+                   此时依赖库已全部加载并完成各自的静态构造，直接测得
+  - static_ctors_est
+                   exec_to_first_ctor - library_load，共享库静态构造的
+                   估计值：两者来自不同的进程，且前者含 fork / exec 本身
+  - exe_ctors      first_ctor_ns 到 main，可执行文件自身的静态构造
+  - allocator_init 首次 at::empty，含 CPU allocator 初始化
+  - first_kernel   首次 at::ones({2,3,4}, at::kFloat)
+  - total          exec 到首个 at::ones 返回
+分别在热页缓存（预先运行一次）与冷页缓存下测量。冷缓存优先写
+/proc/sys/vm/drop_caches（需要 root），否则对可执行文件及其依赖库
+posix_fadvise(DONTNEED)，后者只能驱逐未被其他进程映射的页。
+
+用法:
+    python3 bench/startup_bench.py <BUILD_PATH> [--runs 10]
+        [--modes warm cold] [--json OUT]
+"""
+
+import argparse
+import json
+import os
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+FRAMEWORKS = ("paddle", "torch")
+PROBE_NAME = "first_op_startup"
+DROP_CACHES_PATH = "/proc/sys/vm/drop_caches"
+LOADER_RE = re.compile(
+    r"total startup time in dynamic loader:\s*(\d+)\s*(cycles|ns)?"
+)
+LDD_RE = re.compile(r"=> (\S+) \(0x[0-9a-f]+\)$")
+STAGES = (
+    "library_load",
+    "exec_to_first_ctor",
+    "static_ctors_est",
+    "exe_ctors",
+    "allocator_init",
+    "first_kernel",
+    "total",
+    "steady_ones",
+)
+
+
+def log(msg):
+    """实时日志输出"""
+    print(msg, flush=True)
+
+
+def probe_path(build_path, framework):
+    return os.path.join(
+        build_path, "bench", framework, f"{framework}_{PROBE_NAME}"
+    )
+
+
+def mapped_files(exe):
+    """可执行文件及其依赖的共享库路径"""
+    files = [exe]
+    output = subprocess.run(
+        ["ldd", exe], capture_output=True, text=True, check=False
+    ).stdout
+    for line in output.splitlines():
+        match = LDD_RE.search(line.strip())
+        if match and os.path.exists(match.group(1)):
+            files.append(match.group(1))
+    return files
+
+
+def drop_page_cache(files):
+    """尽量把 files 逐出页缓存，返回所用方法"""
+    os.sync()
+    if os.access(DROP_CACHES_PATH, os.W_OK):
+        with open(DROP_CACHES_PATH, "w") as f:
+            f.write("1\n")
+        return "drop_caches"
+    for path in files:
+        fd = os.open(path, os.O_RDONLY)
+        try:
+            os.posix_fadvise(fd, 0, 0, os.POSIX_FADV_DONTNEED)
+        finally:
+            os.close(fd)
+    return "fadvise"
+
+
+def launch(exe, args=(), env=None):
+    """启动探针，返回 (exec 前时间戳, 探针 JSON, stderr)"""
+    exec_ns = time.clock_gettime_ns(time.CLOCK_MONOTONIC)
+    result = subprocess.run(
+        [exe, *args], capture_output=True, text=True, env=env, check=False
+    )
+    if result.returncode != 0:
+        raise RuntimeError(f"{exe} exited with {result.returncode}")
+    record = None
+    for line in result.stdout.splitlines():
+        if line.startswith("{"):
+            record = json.loads(line)
+    if record is None:
+        raise RuntimeError(f"{exe} printed no probe record")
+    return exec_ns, record, result.stderr
+
+
+def loader_ns(exe):
+    """单独以 LD_DEBUG=statistics 运行一次，返回动态链接器耗时（ns）"""
+    env = dict(os.environ, LD_DEBUG="statistics")
+    _, record, stderr = launch(exe, ["--tsc"], env)
+    match = LOADER_RE.search(stderr)
+    if not match:
+        return None
+    value = float(match.group(1))
+    if match.group(2) == "cycles" and record["tsc_hz"] > 0:
+        return value / record["tsc_hz"] * 1e9
+    if match.group(2) == "ns" or record["tsc_hz"] == 0:
+        return value
+    return None
+
+
+def stages(exec_ns, record, library_load):
+    exec_to_first_ctor = record["first_ctor_ns"] - exec_ns
+    return {
+        "library_load": library_load,
+        "exec_to_first_ctor": exec_to_first_ctor,
+        "static_ctors_est": (
+            None if library_load is None else exec_to_first_ctor - library_load
+        ),
+        "exe_ctors": record["main_ns"] - record["first_ctor_ns"],
+        "allocator_init": record["alloc_end_ns"] - record["alloc_begin_ns"],
+        "first_kernel": record["ones_end_ns"] - record["ones_begin_ns"],
+        "total": record["ones_end_ns"] - exec_ns,
+        "steady_ones": record["steady_ones_ns"],
+    }
+
+
+def measure(exe, mode, runs):
+    """返回 {stage: [ns...]} 与冷缓存方法"""
+    files = mapped_files(exe)
+    method = "warm"
+    if mode == "warm":
+        launch(exe)
+    samples = {stage: [] for stage in STAGES}
+    for _ in range(runs):
+        if mode == "cold":
+            method = drop_page_cache(files)
+        library_load = loader_ns(exe)
+        if mode == "cold":
+            drop_page_cache(files)
+        exec_ns, record, _ = launch(exe)
+        for stage, value in stages(exec_ns, record, library_load).items():
+            if value is not None:
+                samples[stage].append(value)
+    return samples, method
+
+
+def summarize(samples):
+    return {
+        stage: {
+            "median_ns": statistics.median(values),
+            "min_ns": min(values),
+            "max_ns": max(values),
+        }
+        for stage, values in samples.items()
+        if values
+    }
+
+
+def print_report(report):
+    header = f"{'mode':<6} {'stage':<20}" + "".join(
+        f" {fw + ' ms':>12}" for fw in FRAMEWORKS
+    )
+    header += f" {'ratio':>8}"
+    log(header)
+    log("-" * len(header))
+    for mode, frameworks in report.items():
+        for stage in STAGES:
+            values = [
+                frameworks.get(fw, {})
+                .get("stages", {})
+                .get(stage, {})
+                .get("median_ns")
+                for fw in FRAMEWORKS
+            ]
+            cells = "".join(
+                f" {'-':>12}" if v is None else f" {v / 1e6:>12.3f}"
+                for v in values
+            )
+            ratio = (
+                f"{values[0] / values[1]:.2f}x"
+                if None not in values and values[1]
+                else "-"
+            )
+            log(f"{mode:<6} {stage:<20}{cells} {ratio:>8}")
+        methods = {
+            fw: frameworks[fw]["cache_method"]
+            for fw in FRAMEWORKS
+            if fw in frameworks
+        }
+        log(f"{mode:<6} page cache: {methods}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Time-to-first-op 启动耗时对比"
+    )
+    parser.add_argument("build_path", help="构建目录")
+    parser.add_argument("--runs", type=int, default=10, help="每种模式的次数")
+    parser.add_argument(
+        "--modes", nargs="+", default=["warm", "cold"], choices=["warm", "cold"]
+    )
+    parser.add_argument("--json", "-j", default=None, help="输出JSON文件")
+    args = parser.parse_args()
+
+    report = {}
+    for mode in args.modes:
+        report[mode] = {}
+        for framework in FRAMEWORKS:
+            exe = probe_path(args.build_path, framework)
+            if not os.access(exe, os.X_OK):
+                log(f"WARNING: {exe} 不存在，跳过")
+                continue
+            log(f"[{framework}] {mode} x{args.runs}")
+            samples, method = measure(exe, mode, args.runs)
+            report[mode][framework] = {
+                "cache_method": method,
+                "stages": summarize(samples),
+            }
+    if not any(report.values()):
+        log("ERROR: 未找到任何启动探针，请以 -DENABLE_BENCHMARK=ON 构建")
+        sys.exit(1)
+
+    print_report(report)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+        log(f"JSON report saved to: {args.json}")
+
+
+if __name__ == "__main__":
+    main()
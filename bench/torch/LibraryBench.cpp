@@ -0,0 +1,354 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <gtest/gtest.h>
+#include <torch/library.h>
+#if !USE_PADDLE_API
+#include <ATen/core/dispatch/Dispatcher.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bench/common/allocation_counter.h"
+#include "bench/common/benchmark.h"
+#include "bench/common/registered_kernel.h"
+
+namespace at {
+namespace test {
+
+using paddle_api_test::AllocationStats;
+using paddle_api_test::BenchmarkOptions;
+using paddle_api_test::BenchmarkResult;
+using paddle_api_test::CountAllocations;
+using paddle_api_test::DoNotOptimize;
+#if USE_PADDLE_API
+using paddle_api_test::RegisteredKernel;
+#endif
+using paddle_api_test::ReportBenchmark;
+using paddle_api_test::RunBenchmark;
+using paddle_api_test::SubtractEmptyCallBaseline;
+
+constexpr size_t kMaxArgs = 8;
+constexpr int64_t kAllocationProbeCalls = 256;
+
+// "api" 标签写实际被计时的限定名，两端调用的 API 不同
+#if USE_PADDLE_API
+constexpr const char* kLookupApi = "torch::OperatorRegistry::find_operator";
+constexpr const char* kUnboxedCallApi = "torch::CppFunction::call";
+constexpr const char* kBoxedCallApi = "torch::CppFunction::call_with_args";
+#else
+constexpr const char* kLookupApi = "c10::Dispatcher::findSchemaOrThrow";
+constexpr const char* kUnboxedCallApi = "c10::TypedOperatorHandle::call";
+constexpr const char* kBoxedCallApi = "c10::OperatorHandle::callBoxed";
+#endif
+
+static at::Tensor bench_identity(const at::Tensor& t) { return t; }
+
+// args<K>(int a0, ..., int a{K-1}) -> int，内核返回各参数之和
+static std::string int_args_schema(size_t num_args) {
+  std::string schema = "args" + std::to_string(num_args) + "(";
+  for (size_t i = 0; i < num_args; ++i) {
+    schema += (i == 0 ? "int a" : ", int a") + std::to_string(i);
+  }
+  return schema + ") -> int";
+}
+
+template <size_t K, typename = std::make_index_sequence<K>>
+struct IntArgs;
+
+template <size_t K, size_t... I>
+struct IntArgs<K, std::index_sequence<I...>> {
+  template <size_t>
+  using Int = int64_t;
+  using Signature = int64_t(Int<I>...);
+
+  static int64_t sum(Int<I>... args) { return (int64_t{0} + ... + args); }
+
+  // 以 1..K 为实参调用，期望结果为 K * (K + 1) / 2
+  template <typename Op>
+  static auto call(const Op& op) {
+    return op.call(static_cast<int64_t>(I + 1)...);
+  }
+};
+
+// 两端都经 TORCH_LIBRARY 注册；Paddle compat 的 def 不推导函数签名，
+// 内核包装为读取 FunctionArgs 的 CppFunction 后由 impl 注册
+template <size_t K>
+static void def_int_args_op(torch::Library& m) {
+#if USE_PADDLE_API
+  m.def(int_args_schema(K).c_str());
+  m.impl(("args" + std::to_string(K)).c_str(),
+         torch::CppFunction(
+             [](const torch::FunctionArgs& args) -> torch::IValue {
+               int64_t sum = 0;
+               for (size_t i = 0; i < K; ++i) {
+                 sum += args.get<int64_t>(i);
+               }
+               return torch::IValue(sum);
+             }));
+#else
+  m.def(int_args_schema(K).c_str(), &IntArgs<K>::sum);
+#endif
+}
+
+template <size_t... K>
+static void def_int_args_ops(torch::Library& m, std::index_sequence<K...>) {
+  (def_int_args_op<K>(m), ...);
+}
+
+TORCH_LIBRARY(paddle_api_bench_call, m) {
+  def_int_args_ops(m, std::make_index_sequence<kMaxArgs + 1>());
+}
+
+// 由简到繁的典型 schema：参数个数、默认值、alias 注解、列表与重载名
+static const std::vector<std::pair<std::string, std::string>>& schemas() {
+  static const std::vector<std::pair<std::string, std::string>> schemas = {
+      {"no_args", "noop() -> ()"},
+      {"binary", "add(Tensor self, Tensor other) -> Tensor"},
+      {"alias_kwarg",
+       "add_(Tensor(a!) self, Tensor other, *, Scalar alpha=1) -> "
+       "Tensor(a!)"},
+      {"defaults",
+       "zeros(int[] size, ScalarType? dtype=None, Device? device=None, "
+       "bool requires_grad=False) -> Tensor"},
+      {"list", "cat(Tensor[] tensors, int dim=0) -> Tensor"},
+      {"overload",
+       "sum.dim_IntList(Tensor self, int[1]? dim, bool keepdim=False, *, "
+       "ScalarType? dtype=None) -> Tensor"},
+      {"eight_args", int_args_schema(kMaxArgs)},
+  };
+  return schemas;
+}
+
+// FunctionSchema 解析只存在于 Torch；Paddle compat 的 def 只保存 schema
+// 字符串，其成本计入下面的注册测试
+TEST(LibraryBench, SchemaParse) {
+#if USE_PADDLE_API
+  GTEST_SKIP() << "Paddle compat does not expose torch::schema";
+#else
+  for (const auto& [variant, text] : schemas()) {
+    BenchmarkResult result =
+        RunBenchmark("schema_parse/" + variant, [&] {
+          c10::FunctionSchema schema = torch::schema(text.c_str());
+          DoNotOptimize(schema);
+        });
+    const AllocationStats allocs = CountAllocations(
+        [&] {
+          c10::FunctionSchema schema = torch::schema(text.c_str());
+          DoNotOptimize(schema);
+        },
+        kAllocationProbeCalls);
+    result.addCounter(
+        "allocs_per_parse",
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+    result.addCounter(
+        "parses_per_s",
+        1e9 / static_cast<double>(result.histogram.percentile(50)));
+    result.addLabel("api", "torch::schema");
+    result.addLabel("variant", variant);
+    ReportBenchmark(result);
+  }
+#endif
+}
+
+// 每轮在新的命名空间下 def 注册 num_ops 个 identity 算子，对应扩展库
+// 加载时的启动成本。Torch 在 Library 析构时注销全部算子，析构耗时
+// 单独记为 teardown_ns；Paddle compat 的注册表不注销，各轮命名空间
+// 不同以免重名，轮数固定为 3
+static std::unique_ptr<torch::Library> make_library(const std::string& ns) {
+#if USE_PADDLE_API
+  return std::make_unique<torch::Library>(torch::Library::DEF, ns);
+#else
+  return std::make_unique<torch::Library>(
+      torch::Library::DEF, ns, std::nullopt, __FILE__, __LINE__);
+#endif
+}
+
+static void register_identity_ops(torch::Library* lib,
+                                  const std::vector<std::string>& schemas,
+                                  const std::vector<std::string>& names) {
+  for (size_t i = 0; i < schemas.size(); ++i) {
+#if USE_PADDLE_API
+    lib->def(schemas[i].c_str());
+    lib->impl(names[i].c_str(),
+              torch::CppFunction(
+                  [](const torch::FunctionArgs& args) -> torch::IValue {
+                    return torch::IValue(
+                        bench_identity(args.get<at::Tensor>(0)));
+                  }));
+#else
+    (void)names;
+    lib->def(schemas[i].c_str(), &bench_identity);
+#endif
+  }
+}
+
+static std::vector<std::string> identity_op_names(int64_t num_ops) {
+  std::vector<std::string> names;
+  names.reserve(num_ops);
+  for (int64_t i = 0; i < num_ops; ++i) {
+    names.push_back("identity" + std::to_string(i));
+  }
+  return names;
+}
+
+static std::vector<std::string> identity_op_schemas(
+    const std::vector<std::string>& names) {
+  std::vector<std::string> schemas;
+  schemas.reserve(names.size());
+  for (const std::string& name : names) {
+    schemas.push_back(name + "(Tensor self) -> Tensor");
+  }
+  return schemas;
+}
+
+TEST(LibraryBench, Registration) {
+  using Clock = std::chrono::steady_clock;
+  static int library_round = 0;
+  for (int64_t num_ops : {int64_t{100}, int64_t{1000}, int64_t{4000}}) {
+    const std::vector<std::string> names = identity_op_names(num_ops);
+    const std::vector<std::string> schemas = identity_op_schemas(names);
+    std::vector<std::unique_ptr<torch::Library>> libraries;
+    BenchmarkOptions options;
+    options.warmup_iters = 0;
+    options.min_iters = 3;
+    options.max_iters = 3;
+    options.min_time_s = 0.0;
+    BenchmarkResult result = RunBenchmark(
+        "library_register/num_ops=" + std::to_string(num_ops),
+        [&] {
+          const std::string ns =
+              "paddle_api_bench_reg" + std::to_string(library_round++);
+          libraries.push_back(make_library(ns));
+          register_identity_ops(libraries.back().get(), schemas, names);
+        },
+        options);
+    const double p50_ns = static_cast<double>(result.histogram.percentile(50));
+    const auto teardown_begin = Clock::now();
+    libraries.clear();
+    const auto teardown_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             teardown_begin)
+            .count();
+    result.addCounter("num_ops", static_cast<double>(num_ops));
+    result.addCounter("ns_per_op", p50_ns / num_ops);
+    result.addCounter("ops_per_s", num_ops / (p50_ns * 1e-9));
+    result.addCounter("teardown_ns",
+                      static_cast<double>(teardown_ns) / options.max_iters);
+    result.addLabel("api", "torch::Library::def");
+    ReportBenchmark(result);
+  }
+}
+
+// 在已注册 4000 个算子的命名空间中按名查找：Torch 为
+// Dispatcher::findSchemaOrThrow，Paddle compat 为 OperatorRegistry
+TEST(LibraryBench, Lookup) {
+  constexpr int64_t kNumOps = 4000;
+  const std::vector<std::string> names = identity_op_names(kNumOps);
+  const std::vector<std::string> schemas = identity_op_schemas(names);
+  std::unique_ptr<torch::Library> lib = make_library("paddle_api_bench_find");
+  register_identity_ops(lib.get(), schemas, names);
+
+  std::vector<std::string> qualified;
+  for (int64_t i = 0; i < kNumOps; i += kNumOps / 16) {
+    qualified.push_back("paddle_api_bench_find::" + names[i]);
+  }
+  size_t next = 0;
+  BenchmarkResult result = RunBenchmark("library_lookup", [&] {
+    const std::string& name = qualified[next];
+    next = (next + 1) % qualified.size();
+#if USE_PADDLE_API
+    auto&& op = torch::OperatorRegistry::instance().find_operator(name);
+#else
+    auto op = c10::Dispatcher::singleton().findSchemaOrThrow(name.c_str(), "");
+#endif
+    DoNotOptimize(op);
+  });
+  SubtractEmptyCallBaseline(&result);
+  result.addCounter("registered_ops", static_cast<double>(kNumOps));
+  result.addLabel("api", kLookupApi);
+  ReportBenchmark(result);
+}
+
+// 0 到 8 个 int 参数的调用开销，算子在计时前按名查找一次：
+//   unboxed  Torch 为 TypedOperatorHandle::call，Paddle compat 为注册表中
+//            CppFunction 的 call(args...)（内部打包为 FunctionArgs）
+//   boxed    每次调用都重新构造实参：Torch 清空并重新压栈后 callBoxed，
+//            Paddle compat 构造 FunctionArgs 后 call_with_args
+template <size_t K>
+static void run_call_bench() {
+  const int64_t expected = static_cast<int64_t>(K * (K + 1) / 2);
+  const std::string prefix = "library_call/args=" + std::to_string(K);
+  const std::string name = "paddle_api_bench_call::args" + std::to_string(K);
+#if USE_PADDLE_API
+  const torch::CppFunction& op = RegisteredKernel(name);
+  const auto unboxed = [&] {
+    return IntArgs<K>::call(op).template get<int64_t>();
+  };
+  const auto boxed = [&] {
+    torch::FunctionArgs args;
+    for (size_t i = 0; i < K; ++i) {
+      args.add_arg(static_cast<int64_t>(i + 1));
+    }
+    return op.call_with_args(args).template get<int64_t>();
+  };
+#else
+  const c10::OperatorHandle handle =
+      c10::Dispatcher::singleton().findSchemaOrThrow(name.c_str(), "");
+  const auto typed = handle.typed<typename IntArgs<K>::Signature>();
+  torch::jit::Stack stack;
+  stack.reserve(K + 1);
+  const auto unboxed = [&] { return IntArgs<K>::call(typed); };
+  const auto boxed = [&] {
+    stack.clear();
+    for (size_t i = 0; i < K; ++i) {
+      stack.emplace_back(static_cast<int64_t>(i + 1));
+    }
+    handle.callBoxed(stack);
+    return stack[0].toInt();
+  };
+#endif
+  EXPECT_EQ(unboxed(), expected) << prefix;
+  EXPECT_EQ(boxed(), expected) << prefix;
+
+  const auto report = [&](const char* mode,
+                           const char* api,
+                           const auto& fn) {
+    BenchmarkResult result = RunBenchmark(prefix + "/" + mode, [&] {
+      int64_t r = fn();
+      DoNotOptimize(r);
+    });
+    SubtractEmptyCallBaseline(&result);
+    const AllocationStats allocs = CountAllocations(
+        [&] {
+          int64_t r = fn();
+          DoNotOptimize(r);
+        },
+        kAllocationProbeCalls);
+    result.addCounter("num_args", static_cast<double>(K));
+    result.addCounter(
+        "allocs_per_call",
+        static_cast<double>(allocs.allocations) / kAllocationProbeCalls);
+    result.addLabel("api", api);
+    result.addLabel("mode", mode);
+    ReportBenchmark(result);
+  };
+  report("unboxed", kUnboxedCallApi, unboxed);
+  report("boxed", kBoxedCallApi, boxed);
+}
+
+template <size_t... K>
+static void run_call_benches(std::index_sequence<K...>) {
+  (run_call_bench<K>(), ...);
+}
+
+TEST(LibraryBench, Call) {
+  run_call_benches(std::make_index_sequence<kMaxArgs + 1>());
+}
+
+}  // namespace test
+}  // namespace at
@@ -9,7 +9,11 @@ function(
   # Optional named-keyword args (parsed after positional arg USE_PADDLE_API):
   # EXTRA_DEFS  -- extra compile definitions (e.g. PADDLE_WITH_CUDA) EXTRA_INCS
   # -- extra include directories
-  cmake_parse_arguments(PARSE_ARGV 6 _CPT "" "" "EXTRA_DEFS;EXTRA_INCS")
+  # BENCHMARK   -- benchmark binaries: long-running and not diffable, so they
+  # are not registered with ctest and default to an optimized build. They also
+  # link BENCH_BASE_FILES (bench/common/*.cpp).
+  cmake_parse_arguments(PARSE_ARGV 6 _CPT "BENCHMARK" ""
+                        "EXTRA_DEFS;EXTRA_INCS")
 
   foreach(_test_file ${TEST_SRC_FILES})
     get_filename_component(_file_name ${_test_file} NAME_WE)
@@ -19,7 +23,7 @@ function(
     add_dependencies(${_test_name} "googletest.git")
     target_link_libraries(
       ${_test_name} gtest gtest_main ${CMAKE_THREAD_LIBS_INIT}
-      ${DEPS_LIBRARIES} ${Python3_LIBRARIES})
+      ${CMAKE_DL_LIBS} rt ${DEPS_LIBRARIES} ${Python3_LIBRARIES})
     target_include_directories(${_test_name} PRIVATE ${Python3_INCLUDE_DIRS})
     target_include_directories(${_test_name} PRIVATE ${INCLUDE_DIR}
                                                      ${PROJECT_SOURCE_DIR}/src)
@@ -48,9 +52,59 @@ function(
         endif()
       endforeach()
     endif()
-    add_test(NAME ${_test_name} COMMAND ${_test_name})
-    set_tests_properties(${_test_name} PROPERTIES TIMEOUT 5)
+    if(_CPT_BENCHMARK)
+      target_sources(${_test_name} PRIVATE ${BENCH_BASE_FILES})
+      if(NOT CMAKE_BUILD_TYPE)
+        target_compile_options(${_test_name} PRIVATE -O2)
+      endif()
+    else()
+      add_test(NAME ${_test_name} COMMAND ${_test_name})
+      set_tests_properties(${_test_name} PROPERTIES TIMEOUT 5)
+    endif()
     set_target_properties(${_test_name} PROPERTIES RUNTIME_OUTPUT_DIRECTORY
                                                    "${TARGET_FOLDER}")
   endforeach()
 endfunction()
+
+# Time-to-first-op probe (bench/startup/first_op_startup.cpp). Built without
+# gtest and src/ so that only the framework libraries contribute to startup.
+function(
+  create_startup_benchmark
+  BIN_PREFIX
+  TARGET_FOLDER
+  DEPS_LIBRARIES
+  INCLUDE_DIR
+  USE_PADDLE_API)
+  cmake_parse_arguments(PARSE_ARGV 5 _CSB "" "" "EXTRA_DEFS;EXTRA_INCS")
+
+  set(_target_name ${BIN_PREFIX}first_op_startup)
+  add_executable(${_target_name}
+                 ${PROJECT_SOURCE_DIR}/bench/startup/first_op_startup.cpp)
+  target_link_libraries(${_target_name} ${CMAKE_THREAD_LIBS_INIT}
+                        ${DEPS_LIBRARIES} ${Python3_LIBRARIES})
+  target_include_directories(${_target_name} PRIVATE ${Python3_INCLUDE_DIRS}
+                                                     ${INCLUDE_DIR})
+  target_compile_definitions(${_target_name}
+                             PRIVATE USE_PADDLE_API=${USE_PADDLE_API})
+  if(_CSB_EXTRA_DEFS)
+    target_compile_definitions(${_target_name} PRIVATE ${_CSB_EXTRA_DEFS})
+  endif()
+  if(_CSB_EXTRA_INCS)
+    target_include_directories(${_target_name} PRIVATE ${_CSB_EXTRA_INCS})
+  endif()
+  if(NOT USE_PADDLE_API)
+    # Keep libtorch_cuda.so in DT_NEEDED, as the test binaries do, so its
+    # static initializers are part of the measured startup.
+    foreach(_dep_lib ${DEPS_LIBRARIES})
+      if("${_dep_lib}" MATCHES "libtorch_cuda\\.so$")
+        target_link_libraries(${_target_name}
+                              "-Wl,--no-as-needed,${_dep_lib},--as-needed")
+      endif()
+    endforeach()
+  endif()
+  if(NOT CMAKE_BUILD_TYPE)
+    target_compile_options(${_target_name} PRIVATE -O2)
+  endif()
+  set_target_properties(${_target_name} PROPERTIES RUNTIME_OUTPUT_DIRECTORY
+                                                   "${TARGET_FOLDER}")
+endfunction()
@@ -25,6 +25,9 @@ set -euo pipefail
 #   - 输出文件默认生成在 coverage/ 目录下:
 #       coverage/api_coverage_report.txt
 #       coverage/api_coverage_report.json
+#   - 若 /tmp/paddle_cpp_api_test 下已有 benchmark 结果（先运行
+#     bench/bench_cmp.py），报告会附带性能覆盖矩阵：每个 API 是否测试、
+#     是否 benchmark、Paddle/Torch p50 比值，以及高频调用但未 benchmark 的 API
 
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
 TEST_REPO_ROOT="$(cd "${SCRIPT_DIR}/.." && pwd)"
@@ -35,6 +38,8 @@ HEADER_DIR="${WORKSPACE_ROOT}/Paddle/paddle/phi/api/include/compat"
 INCLUDE_DIR_MAIN="${WORKSPACE_ROOT}/Paddle/paddle/phi/api/include"
 INCLUDE_DIR_COMPAT="${WORKSPACE_ROOT}/Paddle/paddle/phi/api/include/compat"
 TEST_DIR="${TEST_REPO_ROOT}/test"
+BENCH_DIR="${TEST_REPO_ROOT}/bench"
+BENCH_RESULTS="${BENCH_RESULTS:-/tmp/paddle_cpp_api_test}"
 OUTPUT_TXT="${SCRIPT_DIR}/api_coverage_report.txt"
 OUTPUT_JSON="${SCRIPT_DIR}/api_coverage_report.json"
 
@@ -58,5 +63,7 @@ python3 "${PYTHON_SCRIPT}" \
     -I "${INCLUDE_DIR_MAIN}" \
     -I "${INCLUDE_DIR_COMPAT}" \
     --test-dir "${TEST_DIR}" \
+    --bench-dir "${BENCH_DIR}" \
+    --bench-results "${BENCH_RESULTS}" \
     --output "${OUTPUT_TXT}" \
     --json "${OUTPUT_JSON}"
@@ -5,6 +5,7 @@ API覆盖率分析工具
 """
 
 import json
+import math
 import os
 import re
 from collections import defaultdict
@@ -730,7 +731,235 @@ def compute_coverage(all_apis, test_analysis):
     return coverage
 
 
-def generate_report(all_apis, test_analysis, coverage, output_file):
+def load_bench_results(results_dir):
+    """读取 benchmark 输出（<framework>_*Bench*.txt 中逐行的 JSON 记录）
+
+    返回 {framework: {(binary_key, case): record}}，binary_key 去掉了
+    paddle_ / torch_ 前缀，便于两框架按 case 配对
+    """
+    results = {"paddle": {}, "torch": {}}
+    if not results_dir or not os.path.isdir(results_dir):
+        return results
+    for filename in sorted(os.listdir(results_dir)):
+        if not filename.endswith(".txt") or "Bench" not in filename:
+            continue
+        framework, _, key = filename[: -len(".txt")].partition("_")
+        if framework not in results:
+            continue
+        path = os.path.join(results_dir, filename)
+        with open(path, encoding="utf-8", errors="ignore") as f:
+            for line in f:
+                line = line.strip()
+                if not line.startswith("{"):
+                    continue
+                try:
+                    record = json.loads(line)
+                except json.JSONDecodeError:
+                    continue
+                results[framework][(key, record.get("name", ""))] = record
+    return results
+
+
+def split_api_label(label):
+    """把 benchmark 的 "api" 标签拆成 (限定符, 名字)
+
+    去掉模板实参，只保留最后一级限定符，如 "c10::Scalar::to<double>" ->
+    ("Scalar", "to")、"sum" -> ("", "sum")
+    """
+    base = re.sub(r"<.*>", "", label).strip()
+    parts = [part for part in base.split("::") if part]
+    if not parts:
+        return "", ""
+    return (parts[-2] if len(parts) > 1 else ""), parts[-1]
+
+
+def resolve_bench_api(label, api_keys):
+    """把 api 标签对应到覆盖率中的 (class_name, name)，失败时返回原因
+
+    api_keys 为 {name: {class_name, ...}}，自由函数的 class_name 为 ""。
+    带限定符的标签先按类名匹配，类名不存在时视为命名空间，匹配同名
+    自由函数；不带限定符的标签优先匹配自由函数，其次匹配唯一一个类中
+    的同名方法，多个类都有同名方法时需要写成 "Class::name"
+    """
+    qualifier, name = split_api_label(label)
+    classes = api_keys.get(name)
+    if not classes:
+        return None, "没有同名 API"
+    if qualifier:
+        if qualifier in classes:
+            return (qualifier, name), None
+        if "" in classes:
+            return ("", name), None
+        return None, f"没有 {qualifier}::{name}"
+    if "" in classes:
+        return ("", name), None
+    if len(classes) == 1:
+        return (next(iter(classes)), name), None
+    return None, "多个类有同名方法: " + ", ".join(
+        f"{cls}::{name}" for cls in sorted(classes)
+    )
+
+
+def compute_bench_ratios(bench_results, coverage):
+    """按 API 聚合两框架 p50 之比（paddle / torch，>1 表示 Paddle 更慢）
+
+    记录只按显式的 "api" 标签归属到 API，同一 API 的多个 case 取几何
+    平均，避免个别大 shape case 主导结果。没有 api 标签或标签对应不到
+    API 的记录不丢弃，分别列入 unlabelled 与 unmatched
+    """
+    api_keys = defaultdict(set)
+    for api in coverage["tested"] + coverage["untested"]:
+        api_keys[api["name"]].add(api["class_name"] or "")
+
+    paddle_results = bench_results["paddle"]
+    torch_results = bench_results["torch"]
+    log_ratios = defaultdict(list)
+    measured = set()
+    unmatched = {}
+    unlabelled = defaultdict(int)
+    for key in set(paddle_results) | set(torch_results):
+        record = paddle_results.get(key) or torch_results.get(key)
+        label = (record.get("labels") or {}).get("api")
+        if not label:
+            unlabelled[key[0]] += 1
+            continue
+        api_key, reason = resolve_bench_api(label, api_keys)
+        if api_key is None:
+            entry = unmatched.setdefault(
+                label, {"api": label, "reason": reason, "cases": 0}
+            )
+            entry["cases"] += 1
+            continue
+        measured.add(api_key)
+        paddle = paddle_results.get(key)
+        torch = torch_results.get(key)
+        if paddle and torch and paddle["p50_ns"] > 0 and torch["p50_ns"] > 0:
+            log_ratios[api_key].append(
+                math.log(paddle["p50_ns"] / torch["p50_ns"])
+            )
+
+    ratios = {}
+    for api_key in measured:
+        values = log_ratios.get(api_key, [])
+        ratios[api_key] = {
+            "cases": len(values),
+            "p50_ratio": (
+                round(math.exp(sum(values) / len(values)), 3)
+                if values
+                else None
+            ),
+        }
+    return {
+        "by_api": ratios,
+        "unmatched": sorted(unmatched.values(), key=lambda u: u["api"]),
+        "unlabelled": [
+            {"binary": binary, "cases": cases}
+            for binary, cases in sorted(unlabelled.items())
+        ],
+    }
+
+
+def count_api_usage(source_dirs, names):
+    """统计每个 API 名在源码中的调用点数，作为"使用热度"的近似
+
+    默认只扫描测试目录；通过 --usage-dir 传入下游自定义算子源码可以得到
+    更贴近生产的热度
+    """
+    call_pattern = re.compile(r"(?<![\w])(\w+)\s*(?:<[^(){};]*>)?\s*\(")
+    counts = defaultdict(int)
+    for source_dir in source_dirs:
+        for root, dirs, files in os.walk(source_dir):
+            for f in files:
+                if not f.endswith((".cpp", ".cc", ".cxx", ".cu", ".h")):
+                    continue
+                path = os.path.join(root, f)
+                with open(path, encoding="utf-8", errors="ignore") as fh:
+                    content = fh.read()
+                for match in call_pattern.finditer(content):
+                    if match.group(1) in names:
+                        counts[match.group(1)] += 1
+    return counts
+
+
+def compute_perf_matrix(
+    coverage, bench_analysis, bench_ratios, usage_counts, hot_threshold
+):
+    """合并覆盖率与 benchmark 结果，得到每个 API 的性能覆盖矩阵
+
+    benchmarked 取值:
+      measured   - 有 benchmark 结果记录（可能只有一个框架）
+      referenced - benchmark 源码中调用过，但没有以它命名的结果记录，
+                   通常只是构造输入，未必测到它的性能
+      ""         - 未出现在 benchmark 中
+    调用点数 >= hot_threshold 且未 measured 的 API 标记为 hot_unbenchmarked。
+    无法归属到 API 的 benchmark 原样列入 unmatched_benchmarks /
+    unlabelled_benchmarks
+    """
+    bench_names = set()
+    if bench_analysis:
+        bench_names.update(bench_analysis["called_functions"])
+        bench_names.update(bench_analysis["called_methods"])
+        bench_names.update(bench_analysis["all_identifiers"])
+
+    matrix = {
+        "apis": [],
+        "hot_unbenchmarked": [],
+        "unmatched_benchmarks": bench_ratios["unmatched"],
+        "unlabelled_benchmarks": bench_ratios["unlabelled"],
+        "summary": {
+            "total_apis": 0,
+            "measured_apis": 0,
+            "referenced_apis": 0,
+            "compared_apis": 0,
+            "slower_apis": 0,
+            "unmatched_labels": len(bench_ratios["unmatched"]),
+            "hot_threshold": hot_threshold,
+        },
+    }
+    summary = matrix["summary"]
+
+    for api in coverage["tested"] + coverage["untested"]:
+        name = api["name"]
+        measured = bench_ratios["by_api"].get((api["class_name"] or "", name))
+        if measured is not None:
+            benchmarked = "measured"
+        elif name in bench_names:
+            benchmarked = "referenced"
+        else:
+            benchmarked = ""
+        ratio = measured["p50_ratio"] if measured else None
+        usage = usage_counts.get(name, 0)
+        row = {
+            "name": name,
+            "class_name": api["class_name"],
+            "source_file": api["source_file"],
+            "tested": api["tested"],
+            "benchmarked": benchmarked,
+            "p50_ratio": ratio,
+            "usage": usage,
+            "hot_unbenchmarked": usage >= hot_threshold
+            and benchmarked != "measured",
+        }
+        matrix["apis"].append(row)
+        summary["total_apis"] += 1
+        if benchmarked == "measured":
+            summary["measured_apis"] += 1
+        elif benchmarked == "referenced":
+            summary["referenced_apis"] += 1
+        if ratio is not None:
+            summary["compared_apis"] += 1
+            if ratio > 1.0:
+                summary["slower_apis"] += 1
+        if row["hot_unbenchmarked"]:
+            matrix["hot_unbenchmarked"].append(row)
+
+    matrix["hot_unbenchmarked"].sort(key=lambda r: (-r["usage"], r["name"]))
+    return matrix
+
+
+def generate_report(
+    all_apis, test_analysis, coverage, output_file, perf_matrix=None
+):
     """生成详细报告"""
     lines = []
 
@@ -868,6 +1097,68 @@ def generate_report(all_apis, test_analysis, coverage, output_file):
 
     lines.append("")
 
+    # 性能覆盖矩阵
+    if perf_matrix is not None:
+        summary = perf_matrix["summary"]
+        lines.append("## 🚀 性能覆盖矩阵")
+        lines.append("-" * 60)
+        lines.append(f"  有benchmark结果:   {summary['measured_apis']}")
+        lines.append(f"  仅在bench中调用:   {summary['referenced_apis']}")
+        lines.append(f"  两框架可比:        {summary['compared_apis']}")
+        lines.append(f"  Paddle更慢:        {summary['slower_apis']}")
+        lines.append("  p50 比值 = paddle / torch，>1 表示 Paddle 更慢")
+        lines.append("")
+
+        if (
+            perf_matrix["unmatched_benchmarks"]
+            or perf_matrix["unlabelled_benchmarks"]
+        ):
+            lines.append("### ⚠️ 无法归属到 API 的 benchmark")
+        for entry in perf_matrix["unmatched_benchmarks"]:
+            lines.append(
+                f"  ? api={entry['api']}: {entry['reason']}"
+                f"（{entry['cases']} 个 case）"
+            )
+        for entry in perf_matrix["unlabelled_benchmarks"]:
+            lines.append(
+                f"  ? {entry['binary']}: 没有 api 标签"
+                f"（{entry['cases']} 个 case）"
+            )
+        lines.append("")
+
+        lines.append(
+            f"### ⚠️ 高频调用但未benchmark "
+            f"(调用点 >= {summary['hot_threshold']})"
+        )
+        for row in perf_matrix["hot_unbenchmarked"]:
+            class_prefix = (
+                f"[{row['class_name']}] " if row["class_name"] else ""
+            )
+            lines.append(
+                f"  ! {class_prefix}{row['name']}: {row['usage']} 处调用"
+            )
+        lines.append("")
+
+        lines.append(
+            f"  {'API':<48} {'测试':>4} {'bench':>10} {'p50比值':>8} "
+            f"{'调用点':>6}"
+        )
+        sorted_rows = sorted(
+            perf_matrix["apis"],
+            key=lambda r: (r["source_file"], r["class_name"] or "", r["name"]),
+        )
+        for row in sorted_rows:
+            class_prefix = f"{row['class_name']}::" if row["class_name"] else ""
+            ratio = row["p50_ratio"]
+            lines.append(
+                f"  {(class_prefix + row['name'])[:48]:<48} "
+                f"{'✓' if row['tested'] else '✗':>4} "
+                f"{row['benchmarked'] or '-':>10} "
+                f"{'-' if ratio is None else f'{ratio:.2f}x':>8} "
+                f"{row['usage']:>6}"
+            )
+        lines.append("")
+
     # 测试文件分析
     lines.append("## 🧪 测试文件分析")
     lines.append("-" * 60)
@@ -918,6 +1209,28 @@ def main():
         "--output", "-o", default="api_coverage_report.txt", help="输出报告文件"
     )
     parser.add_argument("--json", "-j", default=None, help="输出JSON文件")
+    parser.add_argument(
+        "--bench-dir", "-B", default=None, help="benchmark 源码目录"
+    )
+    parser.add_argument(
+        "--bench-results",
+        "-R",
+        default=None,
+        help="benchmark 结果目录（如 /tmp/paddle_cpp_api_test）",
+    )
+    parser.add_argument(
+        "--usage-dir",
+        "-U",
+        action="append",
+        default=[],
+        help="统计调用热度的源码目录，可多次指定，默认使用测试目录",
+    )
+    parser.add_argument(
+        "--hot-threshold",
+        type=int,
+        default=10,
+        help="调用点数不低于该值且未 benchmark 的 API 会被标记",
+    )
 
     args = parser.parse_args()
 
@@ -951,9 +1264,40 @@ def main():
     print(f"  未测试: {coverage['summary']['untested_apis']}")
     print(f"  覆盖率: {coverage['summary']['coverage_rate']}%")
 
+    # 合并 benchmark 结果
+    perf_matrix = None
+    if args.bench_dir or args.bench_results:
+        print("\n合并 benchmark 结果...")
+        bench_analysis = (
+            analyze_test_files(args.bench_dir) if args.bench_dir else None
+        )
+        bench_ratios = compute_bench_ratios(
+            load_bench_results(args.bench_results), coverage
+        )
+        api_names = {
+            api["name"] for api in coverage["tested"] + coverage["untested"]
+        }
+        usage_counts = count_api_usage(
+            args.usage_dir or [args.test_dir], api_names
+        )
+        perf_matrix = compute_perf_matrix(
+            coverage,
+            bench_analysis,
+            bench_ratios,
+            usage_counts,
+            args.hot_threshold,
+        )
+        summary = perf_matrix["summary"]
+        print(f"  有benchmark结果: {summary['measured_apis']}")
+        print(f"  Paddle更慢: {summary['slower_apis']}")
+        print(f"  高频未benchmark: {len(perf_matrix['hot_unbenchmarked'])}")
+        print(f"  无法归属的api标签: {summary['unmatched_labels']}")
+
     # 生成报告
     print(f"\n生成报告: {args.output}")
-    report = generate_report(all_apis, test_analysis, coverage, args.output)
+    report = generate_report(
+        all_apis, test_analysis, coverage, args.output, perf_matrix
+    )
 
     # 保存JSON
     if args.json:
@@ -963,6 +1307,8 @@ def main():
             "tests": test_analysis,
             "coverage": coverage,
         }
+        if perf_matrix is not None:
+            json_data["perf_matrix"] = perf_matrix
         with open(args.json, "w", encoding="utf-8") as f:
             json.dump(json_data, f, indent=2, ensure_ascii=False, default=str)
 
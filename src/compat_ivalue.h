@@ -0,0 +1,36 @@
+#pragma once
+#include <ATen/core/ivalue.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace torch {
+class IValue;
+}  // namespace torch
+
+namespace paddle_api_test {
+
+// 两端的 IValue 分别位于 c10 与 torch 命名空间，取能用 bool / int64 /
+// string 构造并支持 to<int64_t>() 的一个
+template <typename T, typename = void>
+struct is_usable_ivalue : std::false_type {};
+
+template <typename T>
+struct is_usable_ivalue<
+    T,
+    std::void_t<decltype(T(true)),
+                decltype(T(int64_t{1})),
+                decltype(T(std::string("ivalue"))),
+                decltype(std::declval<const T&>().template to<int64_t>())>>
+    : std::true_type {};
+
+using CompatIValue = std::conditional_t<is_usable_ivalue<c10::IValue>::value,
+                                        c10::IValue,
+                                        torch::IValue>;
+
+static_assert(is_usable_ivalue<CompatIValue>::value,
+              "No usable IValue type found in current backend.");
+
+}  // namespace paddle_api_test
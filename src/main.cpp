@@ -9,6 +9,7 @@
 #endif
 
 #include "../src/file_manager.h"
+#include "../src/sampling_profiler.h"
 
 paddle_api_test::ThreadSafeParam g_custom_param;
 
@@ -23,6 +24,12 @@ std::string extract_filename(const std::string& path) {
 int main(int argc, char** argv) {  // NOLINT
   testing::InitGoogleTest(&argc, argv);
 
+  paddle_api_test::SamplingProfilerOptions profiler_options;
+  if (paddle_api_test::ParseSamplingProfilerFlags(
+          &argc, argv, &profiler_options)) {
+    paddle_api_test::InstallSamplingProfiler(profiler_options);
+  }
+
   auto exe_cmd = std::string(argv[0]);
   auto result_file_name = extract_filename(exe_cmd) + ".txt";
   g_custom_param.set(result_file_name);
@@ -0,0 +1,318 @@
+#include "src/sampling_profiler.h"
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace paddle_api_test {
+
+namespace {
+
+constexpr int kMaxDepth = 64;
+// 每个样本占 depth + 2 个字：[test_index, depth, pc...]；4M 字约 32MB，
+// 按 1kHz 足够记录数分钟的深栈，超出后的样本计入 dropped
+constexpr size_t kArenaWords = size_t{1} << 22;
+
+struct ProfilerState {
+  std::atomic<bool> active{false};
+  std::atomic<int> handlers_running{0};
+  std::atomic<int64_t> test_index{-1};
+  std::atomic<size_t> reserved{0};
+  std::atomic<size_t> committed{0};
+  std::atomic<int64_t> dropped{0};
+  bool frame_pointers = false;
+  uintptr_t* arena = nullptr;
+  timer_t timer{};
+  std::string output_path;
+  std::vector<std::string> test_names;
+};
+
+ProfilerState g_profiler;
+
+void interruptedRegisters(void* raw_context, uintptr_t* pc, uintptr_t* fp) {
+  const auto* context = static_cast<const ucontext_t*>(raw_context);
+#if defined(__x86_64__)
+  *pc = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+  *fp = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+#elif defined(__aarch64__)
+  *pc = static_cast<uintptr_t>(context->uc_mcontext.pc);
+  *fp = static_cast<uintptr_t>(context->uc_mcontext.regs[29]);
+#else
+  (void)context;
+  *pc = 0;
+  *fp = 0;
+#endif
+}
+
+// 通过 process_vm_readv 读取自身内存：地址非法时返回失败而不是触发
+// SIGSEGV，可在信号处理函数中安全地沿可能无效的帧指针链读取
+bool readFrame(uintptr_t frame, uintptr_t out[2]) {
+  iovec local = {out, 2 * sizeof(uintptr_t)};
+  iovec remote = {reinterpret_cast<void*>(frame), 2 * sizeof(uintptr_t)};
+  return process_vm_readv(getpid(), &local, 1, &remote, 1, 0) ==
+         static_cast<ssize_t>(2 * sizeof(uintptr_t));
+}
+
+int unwindFramePointers(void* raw_context, uintptr_t* frames) {
+  uintptr_t pc = 0;
+  uintptr_t fp = 0;
+  interruptedRegisters(raw_context, &pc, &fp);
+  int depth = 0;
+  frames[depth++] = pc;
+  while (depth < kMaxDepth && fp != 0 && fp % sizeof(uintptr_t) == 0) {
+    uintptr_t record[2];  // [上一帧的 fp, 返回地址]
+    if (!readFrame(fp, record) || record[1] == 0) {
+      break;
+    }
+    frames[depth++] = record[1];
+    // 栈向低地址增长，调用者的帧必须位于更高地址且相距不远
+    if (record[0] <= fp || record[0] - fp > (uintptr_t{1} << 20)) {
+      break;
+    }
+    fp = record[0];
+  }
+  return depth;
+}
+
+// glibc backtrace() 经 libgcc 按 .eh_frame 展开，能跨过信号帧。
+// 丢弃被中断 pc 之前属于信号处理函数自身的帧
+int unwindBacktrace(void* raw_context, uintptr_t* frames) {
+  uintptr_t pc = 0;
+  uintptr_t fp = 0;
+  interruptedRegisters(raw_context, &pc, &fp);
+  void* raw[kMaxDepth + 4];
+  const int total = backtrace(raw, kMaxDepth + 4);
+  int begin = std::min(total, 2);
+  for (int i = 0; i < total; ++i) {
+    if (reinterpret_cast<uintptr_t>(raw[i]) == pc) {
+      begin = i;
+      break;
+    }
+  }
+  int depth = 0;
+  for (int i = begin; i < total && depth < kMaxDepth; ++i) {
+    frames[depth++] = reinterpret_cast<uintptr_t>(raw[i]);
+  }
+  return depth;
+}
+
+void onSigprof(int, siginfo_t*, void* raw_context) {
+  g_profiler.handlers_running.fetch_add(1, std::memory_order_acquire);
+  if (g_profiler.active.load(std::memory_order_relaxed)) {
+    const int saved_errno = errno;
+    uintptr_t frames[kMaxDepth];
+    const int depth = g_profiler.frame_pointers
+                          ? unwindFramePointers(raw_context, frames)
+                          : unwindBacktrace(raw_context, frames);
+    const size_t words = static_cast<size_t>(depth) + 2;
+    const size_t offset =
+        g_profiler.reserved.fetch_add(words, std::memory_order_relaxed);
+    if (offset + words > kArenaWords) {
+      g_profiler.dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      uintptr_t* slot = g_profiler.arena + offset;
+      slot[0] = static_cast<uintptr_t>(
+          g_profiler.test_index.load(std::memory_order_relaxed));
+      slot[1] = static_cast<uintptr_t>(depth);
+      std::memcpy(slot + 2, frames, depth * sizeof(uintptr_t));
+      // 预留按地址单调增长，成功写入的样本构成 arena 前缀
+      size_t end = g_profiler.committed.load(std::memory_order_relaxed);
+      while (end < offset + words &&
+             !g_profiler.committed.compare_exchange_weak(
+                 end, offset + words, std::memory_order_release)) {
+      }
+    }
+    errno = saved_errno;
+  }
+  g_profiler.handlers_running.fetch_sub(1, std::memory_order_release);
+}
+
+std::string hexString(uintptr_t value) {
+  char buffer[32];
+  std::snprintf(buffer,
+                sizeof(buffer),
+                "0x%llx",
+                static_cast<unsigned long long>(value));  // NOLINT
+  return buffer;
+}
+
+// 有动态符号时返回 demangle 后的函数名，否则与 perf 一样只给出
+// "[模块名]"，避免同一函数的不同指令被拆成多条栈。folded 格式以 ';'
+// 分隔帧，需替换掉
+std::string symbolize(uintptr_t pc, bool return_address) {
+  const uintptr_t lookup = return_address ? pc - 1 : pc;
+  Dl_info info;
+  std::string name;
+  if (dladdr(reinterpret_cast<void*>(lookup), &info) == 0) {
+    name = hexString(pc);
+  } else if (info.dli_sname != nullptr) {
+    int status = 0;
+    char* demangled =
+        abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+    name = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+    std::free(demangled);
+  } else {
+    std::string module = info.dli_fname != nullptr ? info.dli_fname : "?";
+    module = module.substr(module.find_last_of('/') + 1);
+    name = "[" + module + "]";
+  }
+  std::replace(name.begin(), name.end(), ';', ':');
+  return name;
+}
+
+void writeFoldedStacks() {
+  const size_t limit = g_profiler.committed.load(std::memory_order_acquire);
+  std::unordered_map<uintptr_t, std::string> leaf_symbols;
+  std::unordered_map<uintptr_t, std::string> caller_symbols;
+  std::map<std::string, int64_t> folded;
+  int64_t samples = 0;
+  for (size_t offset = 0; offset + 2 <= limit;) {
+    const uintptr_t* slot = g_profiler.arena + offset;
+    const auto test_index = static_cast<int64_t>(slot[0]);
+    const auto depth = static_cast<size_t>(slot[1]);
+    offset += depth + 2;
+    std::string stack =
+        test_index >= 0 &&
+                test_index < static_cast<int64_t>(g_profiler.test_names.size())
+            ? g_profiler.test_names[test_index]
+            : "<unknown>";
+    // 展开结果从叶子到根，folded 格式从根到叶子
+    for (size_t i = depth; i-- > 0;) {
+      const uintptr_t pc = slot[2 + i];
+      auto& cache = i == 0 ? leaf_symbols : caller_symbols;
+      auto it = cache.find(pc);
+      if (it == cache.end()) {
+        it = cache.emplace(pc, symbolize(pc, i != 0)).first;
+      }
+      stack += ";" + it->second;
+    }
+    ++folded[stack];
+    ++samples;
+  }
+
+  std::vector<std::pair<std::string, int64_t>> sorted(folded.begin(),
+                                                      folded.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second > b.second;
+  });
+  std::ofstream out(g_profiler.output_path);
+  for (const auto& [stack, count] : sorted) {
+    out << stack << " " << count << "\n";
+  }
+  std::cout << "[profiler] " << samples << " samples ("
+            << g_profiler.dropped.load() << " dropped, "
+            << sorted.size() << " unique stacks) written to "
+            << g_profiler.output_path << std::endl;
+}
+
+class SamplingProfilerListener : public ::testing::EmptyTestEventListener {
+ public:
+  void OnTestStart(const ::testing::TestInfo& info) override {
+    g_profiler.test_names.push_back(std::string(info.test_suite_name()) + "." +
+                                    info.name());
+    g_profiler.test_index.store(
+        static_cast<int64_t>(g_profiler.test_names.size()) - 1);
+    g_profiler.active.store(true);
+  }
+
+  void OnTestEnd(const ::testing::TestInfo&) override {
+    g_profiler.active.store(false);
+  }
+
+  void OnTestProgramEnd(const ::testing::UnitTest&) override {
+    g_profiler.active.store(false);
+    timer_delete(g_profiler.timer);
+    while (g_profiler.handlers_running.load(std::memory_order_acquire) > 0) {
+    }
+    writeFoldedStacks();
+  }
+};
+
+bool consumeFlag(const char* arg, const char* name, std::string* value) {
+  const size_t length = std::strlen(name);
+  if (std::strncmp(arg, name, length) != 0 || arg[length] != '=') {
+    return false;
+  }
+  *value = arg + length + 1;
+  return true;
+}
+
+}  // namespace
+
+bool ParseSamplingProfilerFlags(int* argc,
+                                char** argv,
+                                SamplingProfilerOptions* options) {
+  int kept = 1;
+  for (int i = 1; i < *argc; ++i) {
+    std::string value;
+    if (consumeFlag(argv[i], "--profile_out", &value)) {
+      options->output_path = value;
+    } else if (consumeFlag(argv[i], "--profile_hz", &value)) {
+      options->hz = std::max(1, std::atoi(value.c_str()));
+    } else if (consumeFlag(argv[i], "--profile_unwind", &value)) {
+      options->frame_pointers = value == "fp";
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  *argc = kept;
+  argv[kept] = nullptr;
+  return !options->output_path.empty();
+}
+
+void InstallSamplingProfiler(const SamplingProfilerOptions& options) {
+  g_profiler.output_path = options.output_path;
+  g_profiler.frame_pointers = options.frame_pointers;
+  g_profiler.arena = new uintptr_t[kArenaWords];
+  // 首次调用 backtrace 会加载 libgcc_s，不能发生在信号处理函数中
+  void* warmup[4];
+  backtrace(warmup, 4);
+
+  struct sigaction action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_sigaction = onSigprof;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGPROF, &action, nullptr);
+
+  sigevent event;
+  std::memset(&event, 0, sizeof(event));
+  event.sigev_notify = SIGEV_SIGNAL;
+  event.sigev_signo = SIGPROF;
+  if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &g_profiler.timer) != 0) {
+    std::cerr << "[profiler] timer_create failed: " << std::strerror(errno)
+              << std::endl;
+    return;
+  }
+  const int64_t interval_ns = 1000000000 / options.hz;
+  itimerspec spec;
+  spec.it_interval.tv_sec = interval_ns / 1000000000;
+  spec.it_interval.tv_nsec = interval_ns % 1000000000;
+  spec.it_value = spec.it_interval;
+  timer_settime(g_profiler.timer, 0, &spec, nullptr);
+
+  ::testing::UnitTest::GetInstance()->listeners().Append(
+      new SamplingProfilerListener());
+}
+
+}  // namespace paddle_api_test
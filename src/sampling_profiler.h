@@ -0,0 +1,28 @@
+#pragma once
+#include <string>
+
+namespace paddle_api_test {
+
+// 基于 timer_create + SIGPROF 的进程内采样 profiler，测试与 benchmark
+// 二进制共用。命令行参数（在 InitGoogleTest 之后解析）：
+//   --profile_out=<path>   开启采样，测试结束后写出 folded stacks
+//   --profile_hz=<n>       按进程 CPU 时间的采样频率，默认 997
+//   --profile_unwind=<m>   backtrace（默认，按 .eh_frame 展开，不依赖帧指针）
+//                          或 fp（帧指针，需以 -fno-omit-frame-pointer 构建）
+// 只在各测试体执行期间采样，每条栈以 "Suite.Name" 作为根帧，配合
+// --gtest_filter 选择要分析的用例；输出可直接交给 flamegraph.pl。
+struct SamplingProfilerOptions {
+  std::string output_path;
+  int hz = 997;
+  bool frame_pointers = false;
+};
+
+// 从 argv 中移除 --profile_* 参数，返回是否给出了 --profile_out
+bool ParseSamplingProfilerFlags(int* argc,
+                                char** argv,
+                                SamplingProfilerOptions* options);
+
+// 注册 gtest 监听器并创建采样定时器，需在 RUN_ALL_TESTS 之前调用
+void InstallSamplingProfiler(const SamplingProfilerOptions& options);
+
+}  // namespace paddle_api_test
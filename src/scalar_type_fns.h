@@ -0,0 +1,98 @@
+#pragma once
+#include <ATen/AccumulateType.h>
+#include <c10/core/ScalarType.h>
+
+#include <type_traits>
+
+namespace paddle_api_test {
+
+// ScalarType 工具函数包装为带模板 operator() 的函数对象：同一个对象既用于
+// bench/c10/core/ScalarTypeBench.cpp 的计时，也用于
+// test/c10/core/ScalarTypeFunctionsTest.cpp 探测能否在常量表达式中求值。
+// constexpr 函数模板调用非 constexpr 函数不是错误，只是该实例不能用于
+// 常量表达式
+struct ElementSizeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return c10::elementSize(t);
+  }
+};
+
+struct IsFloatingTypeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return c10::isFloatingType(t);
+  }
+};
+
+struct IsIntegralTypeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return c10::isIntegralType(t, /*includeBool=*/false);
+  }
+};
+
+struct IsComplexTypeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return c10::isComplexType(t);
+  }
+};
+
+struct IsReducedFloatingTypeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return c10::isReducedFloatingType(t);
+  }
+};
+
+struct ToAccumulateTypeFn {
+  template <typename T>
+  constexpr auto operator()(T t) const {
+    return at::toAccumulateType(t, c10::DeviceType::CPU);
+  }
+};
+
+struct PromoteTypesFn {
+  template <typename T>
+  constexpr auto operator()(T a, T b) const {
+    return c10::promoteTypes(a, b);
+  }
+};
+
+struct CanCastFn {
+  template <typename T>
+  constexpr auto operator()(T from, T to) const {
+    return c10::canCast(from, to);
+  }
+};
+
+// 默认模板实参中的调用只有在常量表达式中可求值时才替换成功
+template <typename Fn, c10::ScalarType... Args, int = (Fn{}(Args...), 0)>
+constexpr bool UsableInConstexpr(int) {
+  return true;
+}
+
+template <typename Fn, c10::ScalarType... Args>
+constexpr bool UsableInConstexpr(...) {
+  return false;
+}
+
+template <typename Fn>
+constexpr bool IsBinaryTypeFn() {
+  return std::is_invocable_v<const Fn&, c10::ScalarType, c10::ScalarType>;
+}
+
+// 以 (Half) 或 (Half, Float) 为实参探测
+template <typename Fn>
+constexpr bool ConstexprUsable() {
+  if constexpr (IsBinaryTypeFn<Fn>()) {
+    return UsableInConstexpr<Fn,
+                             c10::ScalarType::Half,
+                             c10::ScalarType::Float>(0);
+  } else {
+    return UsableInConstexpr<Fn, c10::ScalarType::Half>(0);
+  }
+}
+
+}  // namespace paddle_api_test
@@ -0,0 +1,321 @@
+#pragma once
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <c10/util/BFloat16.h>
+#include <c10/util/Half.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace paddle_api_test {
+
+// 内存布局：逻辑 shape 相同，stride 不同
+enum class SweepLayout {
+  kContiguous,
+  kTransposed,    // 最后两维转置，rank >= 2
+  kStrided,       // 最后一维步长为 2 的切片
+  kChannelsLast,  // NHWC 存储、NCHW 逻辑视图，仅 rank == 4
+};
+
+struct SweepCase {
+  at::ScalarType dtype;
+  std::vector<int64_t> shape;
+  SweepLayout layout;
+
+  int64_t numel() const;
+  // 形如 Float_r3_2x5x10_transposed，可直接用作 gtest 参数名
+  std::string name() const;
+};
+
+// 笛卡尔积的各个维度。numels 中超过 max_numel 的取值会被丢弃：
+// 正确性测试默认只跑到 1e4 元素以满足 ctest 超时，benchmark 或
+// 设置环境变量 PADDLE_API_SWEEP_MAX_NUMEL 可放开到 1e8。
+struct SweepSpec {
+  std::vector<at::ScalarType> dtypes = {at::kFloat,
+                                        at::kDouble,
+                                        at::kHalf,
+                                        at::kBFloat16,
+                                        at::kInt,
+                                        at::kLong,
+                                        at::kBool};
+  std::vector<int64_t> ranks = {1, 2, 3, 4};
+  std::vector<int64_t> numels = {1, 100, 10000, 1000000, 100000000};
+  std::vector<SweepLayout> layouts = {SweepLayout::kContiguous,
+                                      SweepLayout::kTransposed,
+                                      SweepLayout::kStrided,
+                                      SweepLayout::kChannelsLast};
+  int64_t max_numel = SweepMaxNumel();
+
+  // 环境变量 PADDLE_API_SWEEP_MAX_NUMEL，未设置时返回 default_value
+  static int64_t SweepMaxNumel(int64_t default_value = 10000);
+};
+
+// benchmark 的元素数阶梯：保留 candidates 中不超过
+// SweepSpec::SweepMaxNumel(default_max) 的取值，顺序不变
+std::vector<int64_t> SweepNumels(std::initializer_list<int64_t> candidates,
+                                 int64_t default_max);
+
+// 生成 dtype x rank x numel x layout 的笛卡尔积，跳过布局不适用的组合
+std::vector<SweepCase> MakeSweep(const SweepSpec& spec = {});
+
+// 把 numel 拆成 rank 个尽量接近的维度，乘积严格等于 numel
+std::vector<int64_t> ShapeForNumel(int64_t numel, int64_t rank);
+
+// 按 case 构造 tensor：底层存储按 (i % 7) - 3 填充（bool 为 i % 2），
+// 数值小且为整数，浮点累加结果在两个框架间可精确比较
+at::Tensor MakeSweepTensor(const SweepCase& sweep_case);
+
+const char* SweepLayoutName(SweepLayout layout);
+
+// INSTANTIATE_TEST_SUITE_P 的参数命名函数
+std::string SweepCaseName(const ::testing::TestParamInfo<SweepCase>& info);
+
+void PrintTo(const SweepCase& sweep_case, std::ostream* os);
+
+// TYPED_TEST 使用的 C++ 类型列表及其到 ScalarType 的映射
+using SweepDtypes = ::testing::
+    Types<float, double, c10::Half, c10::BFloat16, int32_t, int64_t, bool>;
+
+template <typename T>
+struct SweepScalarType;
+
+#define PADDLE_API_TEST_SWEEP_SCALAR_TYPE(cpp_type, scalar_type) \
+  template <>                                                     \
+  struct SweepScalarType<cpp_type> {                              \
+    static constexpr at::ScalarType value = scalar_type;          \
+  };
+
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(float, at::kFloat)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(double, at::kDouble)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(c10::Half, at::kHalf)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(c10::BFloat16, at::kBFloat16)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(int32_t, at::kInt)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(int64_t, at::kLong)
+PADDLE_API_TEST_SWEEP_SCALAR_TYPE(bool, at::kBool)
+#undef PADDLE_API_TEST_SWEEP_SCALAR_TYPE
+
+// 只保留指定 dtype 的 case，供 TYPED_TEST 按 TypeParam 过滤
+std::vector<SweepCase> FilterSweep(const std::vector<SweepCase>& cases,
+                                   at::ScalarType dtype);
+
+// 以下为内联实现。放在头文件中是为了只让包含它的测试与 benchmark 编译，
+// 而不随 src/*.cpp 链接进每个正确性测试二进制
+
+namespace sweep_internal {
+
+template <typename T>
+inline void fillPattern(at::Tensor* storage) {
+  T* data = storage->data_ptr<T>();
+  const int64_t numel = storage->numel();
+  for (int64_t i = 0; i < numel; ++i) {
+    data[i] = static_cast<T>(static_cast<float>(i % 7 - 3));
+  }
+}
+
+template <>
+inline void fillPattern<bool>(at::Tensor* storage) {
+  bool* data = storage->data_ptr<bool>();
+  const int64_t numel = storage->numel();
+  for (int64_t i = 0; i < numel; ++i) {
+    data[i] = (i % 2) != 0;
+  }
+}
+
+inline void fillStorage(at::Tensor* storage) {
+  switch (storage->scalar_type()) {
+    case at::kFloat:
+      fillPattern<float>(storage);
+      break;
+    case at::kDouble:
+      fillPattern<double>(storage);
+      break;
+    case at::kHalf:
+      fillPattern<c10::Half>(storage);
+      break;
+    case at::kBFloat16:
+      fillPattern<c10::BFloat16>(storage);
+      break;
+    case at::kInt:
+      fillPattern<int32_t>(storage);
+      break;
+    case at::kLong:
+      fillPattern<int64_t>(storage);
+      break;
+    case at::kBool:
+      fillPattern<bool>(storage);
+      break;
+    default:
+      throw std::runtime_error(std::string("Unsupported sweep dtype: ") +
+                               c10::toString(storage->scalar_type()));
+  }
+}
+
+inline bool layoutApplies(SweepLayout layout, int64_t rank) {
+  switch (layout) {
+    case SweepLayout::kTransposed:
+      return rank >= 2;
+    case SweepLayout::kChannelsLast:
+      return rank == 4;
+    default:
+      return true;
+  }
+}
+
+}  // namespace sweep_internal
+
+inline int64_t SweepSpec::SweepMaxNumel(int64_t default_value) {
+  const char* env = std::getenv("PADDLE_API_SWEEP_MAX_NUMEL");
+  if (env != nullptr && std::atoll(env) > 0) {
+    return std::atoll(env);
+  }
+  return default_value;
+}
+
+inline std::vector<int64_t> SweepNumels(
+    std::initializer_list<int64_t> candidates, int64_t default_max) {
+  const int64_t max_numel = SweepSpec::SweepMaxNumel(default_max);
+  std::vector<int64_t> numels;
+  for (int64_t numel : candidates) {
+    if (numel <= max_numel) {
+      numels.push_back(numel);
+    }
+  }
+  return numels;
+}
+
+inline int64_t SweepCase::numel() const {
+  int64_t n = 1;
+  for (int64_t dim : shape) {
+    n *= dim;
+  }
+  return n;
+}
+
+inline std::string SweepCase::name() const {
+  std::string result = std::string(c10::toString(dtype)) + "_r" +
+                       std::to_string(shape.size()) + "_";
+  for (size_t i = 0; i < shape.size(); ++i) {
+    result += (i == 0 ? "" : "x") + std::to_string(shape[i]);
+  }
+  return result + "_" + SweepLayoutName(layout);
+}
+
+inline const char* SweepLayoutName(SweepLayout layout) {
+  switch (layout) {
+    case SweepLayout::kContiguous:
+      return "contiguous";
+    case SweepLayout::kTransposed:
+      return "transposed";
+    case SweepLayout::kStrided:
+      return "strided";
+    case SweepLayout::kChannelsLast:
+      return "channels_last";
+  }
+  return "unknown";
+}
+
+inline std::vector<int64_t> ShapeForNumel(int64_t numel, int64_t rank) {
+  std::vector<int64_t> factors;
+  int64_t remaining = numel;
+  for (int64_t p = 2; p * p <= remaining; ++p) {
+    while (remaining % p == 0) {
+      factors.push_back(p);
+      remaining /= p;
+    }
+  }
+  if (remaining > 1) {
+    factors.push_back(remaining);
+  }
+  // 从大到小把质因子分给当前最小的维度，得到尽量均衡的 shape
+  std::sort(factors.begin(), factors.end(), std::greater<int64_t>());
+  std::vector<int64_t> shape(rank, 1);
+  for (int64_t factor : factors) {
+    *std::min_element(shape.begin(), shape.end()) *= factor;
+  }
+  std::sort(shape.begin(), shape.end());
+  return shape;
+}
+
+inline std::vector<SweepCase> MakeSweep(const SweepSpec& spec) {
+  std::vector<SweepCase> cases;
+  for (at::ScalarType dtype : spec.dtypes) {
+    for (int64_t rank : spec.ranks) {
+      for (int64_t numel : spec.numels) {
+        if (numel > spec.max_numel) {
+          continue;
+        }
+        for (SweepLayout layout : spec.layouts) {
+          if (!sweep_internal::layoutApplies(layout, rank)) {
+            continue;
+          }
+          cases.push_back({dtype, ShapeForNumel(numel, rank), layout});
+        }
+      }
+    }
+  }
+  return cases;
+}
+
+inline at::Tensor MakeSweepTensor(const SweepCase& sweep_case) {
+  const auto options = at::TensorOptions().dtype(sweep_case.dtype);
+  const int64_t rank = static_cast<int64_t>(sweep_case.shape.size());
+  std::vector<int64_t> storage_shape = sweep_case.shape;
+  switch (sweep_case.layout) {
+    case SweepLayout::kContiguous: {
+      at::Tensor t = at::empty(storage_shape, options);
+      sweep_internal::fillStorage(&t);
+      return t;
+    }
+    case SweepLayout::kTransposed: {
+      std::swap(storage_shape[rank - 2], storage_shape[rank - 1]);
+      at::Tensor storage = at::empty(storage_shape, options);
+      sweep_internal::fillStorage(&storage);
+      return storage.transpose(rank - 2, rank - 1);
+    }
+    case SweepLayout::kStrided: {
+      const int64_t last = storage_shape[rank - 1];
+      storage_shape[rank - 1] = last * 2;
+      at::Tensor storage = at::empty(storage_shape, options);
+      sweep_internal::fillStorage(&storage);
+      return storage.slice(rank - 1, 0, last * 2, 2);
+    }
+    case SweepLayout::kChannelsLast: {
+      const auto& s = sweep_case.shape;
+      at::Tensor storage = at::empty({s[0], s[2], s[3], s[1]}, options);
+      sweep_internal::fillStorage(&storage);
+      return storage.permute({0, 3, 1, 2});
+    }
+  }
+  throw std::runtime_error("Unknown sweep layout");
+}
+
+inline std::string SweepCaseName(
+    const ::testing::TestParamInfo<SweepCase>& info) {
+  return info.param.name();
+}
+
+inline void PrintTo(const SweepCase& sweep_case, std::ostream* os) {
+  *os << sweep_case.name();
+}
+
+inline std::vector<SweepCase> FilterSweep(const std::vector<SweepCase>& cases,
+                                          at::ScalarType dtype) {
+  std::vector<SweepCase> result;
+  for (const auto& sweep_case : cases) {
+    if (sweep_case.dtype == dtype) {
+      result.push_back(sweep_case);
+    }
+  }
+  return result;
+}
+
+}  // namespace paddle_api_test
@@ -0,0 +1,109 @@
+#pragma once
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/narrow.h>
+#include <ATen/ops/permute.h>
+#include <ATen/ops/reshape.h>
+#include <ATen/ops/select.h>
+#include <ATen/ops/slice.h>
+#include <ATen/ops/squeeze.h>
+#include <ATen/ops/transpose.h>
+#include <ATen/ops/unsqueeze.h>
+#include <ATen/ops/view.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace paddle_api_test {
+
+// test/ATen/ops/ViewComplexityTest.cpp 的结构检查与
+// bench/ATen/ops/ViewComplexityBench.cpp 的计时共用的视图算子与输入
+
+// 每个规模的输入：一块未初始化的 3 维连续 tensor 及其派生视图
+struct ViewInputs {
+  at::Tensor x;           // {d0, d1, d2}
+  at::Tensor matrix;      // {d0, d1 * d2}，供 t() 使用
+  at::Tensor unsqueezed;  // {1, d0, d1, d2}，供 squeeze 使用
+  at::Tensor other;       // {d0 * d1, d2}，供 view_as 使用
+};
+
+struct ViewOpCase {
+  const char* name;
+  std::function<at::Tensor(const ViewInputs&)> fn;
+};
+
+// 1e2 / 1e5 / 1e8 个元素的 3 维 shape，超过 max_numel 的规模被跳过
+inline std::vector<std::vector<int64_t>> ViewComplexityShapes(
+    int64_t max_numel) {
+  std::vector<std::vector<int64_t>> shapes;
+  for (const std::vector<int64_t>& shape :
+       {std::vector<int64_t>{4, 5, 5},
+        std::vector<int64_t>{40, 50, 50},
+        std::vector<int64_t>{400, 500, 500}}) {
+    if (shape[0] * shape[1] * shape[2] <= max_numel) {
+      shapes.push_back(shape);
+    }
+  }
+  return shapes;
+}
+
+inline ViewInputs MakeViewInputs(const std::vector<int64_t>& shape) {
+  ViewInputs in;
+  in.x = at::empty(shape, at::kFloat);
+  in.matrix = in.x.view({shape[0], shape[1] * shape[2]});
+  in.unsqueezed = in.x.unsqueeze(0);
+  in.other = in.x.view({shape[0] * shape[1], shape[2]});
+  return in;
+}
+
+inline std::vector<ViewOpCase> ViewOpCases() {
+  return {
+      {"View", [](const ViewInputs& in) { return in.x.view({-1}); }},
+      {"Reshape", [](const ViewInputs& in) { return in.x.reshape({-1}); }},
+      {"Transpose", [](const ViewInputs& in) { return in.x.transpose(0, 2); }},
+      {"Permute", [](const ViewInputs& in) { return in.x.permute({2, 0, 1}); }},
+      {"Narrow", [](const ViewInputs& in) { return in.x.narrow(1, 1, 2); }},
+      {"Select", [](const ViewInputs& in) { return in.x.select(0, 1); }},
+      {"Slice", [](const ViewInputs& in) { return in.x.slice(2, 0, 2); }},
+      {"Squeeze",
+       [](const ViewInputs& in) { return in.unsqueezed.squeeze(0); }},
+      {"Unsqueeze", [](const ViewInputs& in) { return in.x.unsqueeze(1); }},
+      {"T", [](const ViewInputs& in) { return in.matrix.t(); }},
+      {"ViewAs", [](const ViewInputs& in) { return in.x.view_as(in.other); }},
+  };
+}
+
+// 供 INSTANTIATE_TEST_SUITE_P 使用的参数名
+inline std::string ViewOpCaseName(
+    const ::testing::TestParamInfo<ViewOpCase>& info) {
+  return info.param.name;
+}
+
+// 各规模的输入在整个 suite 内共享。Derived 提供 static int64_t
+// MaxNumel()，决定 ViewComplexityShapes 保留到哪个规模
+template <typename Derived>
+class ViewInputsSuite : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    inputs_ = new std::vector<ViewInputs>();
+    for (const auto& shape : ViewComplexityShapes(Derived::MaxNumel())) {
+      inputs_->push_back(MakeViewInputs(shape));
+    }
+  }
+
+  static void TearDownTestSuite() {
+    delete inputs_;
+    inputs_ = nullptr;
+  }
+
+  static std::vector<ViewInputs>* inputs_;
+};
+
+template <typename Derived>
+std::vector<ViewInputs>* ViewInputsSuite<Derived>::inputs_ = nullptr;
+
+}  // namespace paddle_api_test
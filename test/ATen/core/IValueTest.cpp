@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "src/compat_ivalue.h"
 #include "src/file_manager.h"
 
 namespace torch {
@@ -30,27 +31,9 @@ extern paddle_api_test::ThreadSafeParam g_custom_param;
 namespace at {
 namespace test {
 
+using paddle_api_test::CompatIValue;
 using paddle_api_test::FileManerger;
 
-template <typename T, typename = void>
-struct is_usable_ivalue : std::false_type {};
-
-template <typename T>
-struct is_usable_ivalue<
-    T,
-    std::void_t<decltype(T(true)),
-                decltype(T(int64_t{1})),
-                decltype(T(std::string("ivalue"))),
-                decltype(std::declval<const T&>().template to<int64_t>())>>
-    : std::true_type {};
-
-using CompatIValue = std::conditional_t<is_usable_ivalue<c10::IValue>::value,
-                                        c10::IValue,
-                                        torch::IValue>;
-
-static_assert(is_usable_ivalue<CompatIValue>::value,
-              "No usable IValue type found in current backend.");
-
 class IValueTestCustomHolder : public torch::CustomClassHolder {};
 
 std::string to_lower_ascii(std::string value) {
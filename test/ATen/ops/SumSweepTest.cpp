@@ -0,0 +1,85 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/ops/sum.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "src/file_manager.h"
+#include "src/tensor_sweep.h"
+
+extern paddle_api_test::ThreadSafeParam g_custom_param;
+
+namespace at {
+namespace test {
+
+using paddle_api_test::FileManerger;
+using paddle_api_test::FilterSweep;
+using paddle_api_test::MakeSweep;
+using paddle_api_test::MakeSweepTensor;
+using paddle_api_test::SweepCase;
+using paddle_api_test::SweepCaseName;
+using paddle_api_test::SweepDtypes;
+using paddle_api_test::SweepScalarType;
+using paddle_api_test::ThreadSafeParam;
+
+// 默认 sweep: 7 种 dtype x rank 1~4 x 1~1e4 元素 x 4 种布局。
+// 设置 PADDLE_API_SWEEP_MAX_NUMEL 可把元素数放开到 1e8。
+class SumSweepTest : public ::testing::TestWithParam<SweepCase> {};
+
+// 全量求和：输出结果 dtype 与数值
+TEST_P(SumSweepTest, FullReduction) {
+  const SweepCase& sweep_case = GetParam();
+  at::Tensor input = MakeSweepTensor(sweep_case);
+  at::Tensor result = at::sum(input);
+
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "FullReduction_" << sweep_case.name() << " ";
+  file << std::to_string(static_cast<int>(result.scalar_type())) << " ";
+  file << std::to_string(result.to(at::kDouble).item<double>()) << " ";
+  file << "\n";
+  file.saveFile();
+}
+
+INSTANTIATE_TEST_SUITE_P(Sweep,
+                         SumSweepTest,
+                         ::testing::ValuesIn(MakeSweep()),
+                         SweepCaseName);
+
+template <typename T>
+class SumSweepTypedTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(SumSweepTypedTest, SweepDtypes);
+
+// 按 C++ 类型读取 contiguous() 后的数据手工累加，与 at::sum 对比
+TYPED_TEST(SumSweepTypedTest, MatchesManualAccumulation) {
+  const at::ScalarType dtype = SweepScalarType<TypeParam>::value;
+  int64_t matched = 0;
+  int64_t total = 0;
+  for (const auto& sweep_case : FilterSweep(MakeSweep(), dtype)) {
+    at::Tensor input = MakeSweepTensor(sweep_case).contiguous();
+    const TypeParam* data = input.data_ptr<TypeParam>();
+    double expected = 0.0;
+    for (int64_t i = 0; i < input.numel(); ++i) {
+      expected += static_cast<double>(static_cast<float>(data[i]));
+    }
+    const double actual = at::sum(input).to(at::kDouble).item<double>();
+    matched += expected == actual ? 1 : 0;
+    ++total;
+  }
+
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "MatchesManualAccumulation_" << c10::toString(dtype) << " ";
+  file << std::to_string(matched) << " ";
+  file << std::to_string(total) << " ";
+  file << "\n";
+  file.saveFile();
+}
+
+}  // namespace test
+}  // namespace at
@@ -0,0 +1,108 @@
+#include <ATen/ATen.h>
+#include <ATen/core/Tensor.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "src/file_manager.h"
+#include "src/view_complexity_cases.h"
+
+extern paddle_api_test::ThreadSafeParam g_custom_param;
+
+namespace at {
+namespace test {
+
+using paddle_api_test::FileManerger;
+using paddle_api_test::ThreadSafeParam;
+using paddle_api_test::ViewInputsSuite;
+using paddle_api_test::ViewOpCase;
+using paddle_api_test::ViewOpCaseName;
+using paddle_api_test::ViewOpCases;
+
+// view 类算子与元数据访问只改写 shape / stride，不应分配新存储或拷贝数据。
+// 这里只做结构检查：结果与输入共享同一块存储，存储大小不变，数据指针
+// 等于输入基址加上结果的 storage_offset。耗时随元素数的变化（含 1e8 规模）
+// 由 bench/ATen/ops/ViewComplexityBench.cpp 测量，不放进 ctest
+
+// ctest 超时内只跑 1e2 / 1e5 两个规模
+class ViewComplexityBase : public ViewInputsSuite<ViewComplexityBase> {
+ public:
+  static int64_t MaxNumel() { return 100000; }
+};
+
+class ViewComplexityTest
+    : public ViewComplexityBase,
+      public ::testing::WithParamInterface<ViewOpCase> {};
+
+class MetadataComplexityTest : public ViewComplexityBase {};
+
+// 结果必须是输入存储上的视图：同一块存储、大小不变、数据指针与
+// storage_offset 一致（输入本身的 storage_offset 为 0）
+static void expect_view_of(const std::string& name,
+                           const at::Tensor& r,
+                           const at::Tensor& base) {
+  EXPECT_TRUE(r.storage().is_alias_of(base.storage()))
+      << name << " did not return a view";
+  EXPECT_EQ(r.storage().nbytes(), base.storage().nbytes())
+      << name << " allocated a new storage";
+  EXPECT_EQ(static_cast<const char*>(r.data_ptr()),
+            static_cast<const char*>(base.data_ptr()) +
+                r.storage_offset() * r.element_size())
+      << name << " data pointer does not match its storage offset";
+}
+
+static void write_shape(FileManerger* file, const at::Tensor& t) {
+  *file << std::to_string(t.dim()) << " ";
+  for (int64_t i = 0; i < t.dim(); ++i) {
+    *file << std::to_string(t.sizes()[i]) << " ";
+  }
+}
+
+TEST_P(ViewComplexityTest, SharesStorage) {
+  const ViewOpCase& op = GetParam();
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "SharesStorage_" << op.name << " ";
+  for (const auto& in : *inputs_) {
+    at::Tensor r = op.fn(in);
+    expect_view_of(op.name, r, in.x);
+    write_shape(&file, r);
+    file << std::to_string(r.storage_offset()) << " ";
+  }
+  file << "\n";
+  file.saveFile();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ViewOps,
+    ViewComplexityTest,
+    ::testing::ValuesIn(ViewOpCases()),
+    ViewOpCaseName);
+
+// 元数据访问器直接返回缓存的 shape / stride，且不改变存储
+TEST_F(MetadataComplexityTest, Accessors) {
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "MetadataAccessors ";
+  for (const auto& in : *inputs_) {
+    const at::IntArrayRef sizes = in.x.sizes();
+    const at::IntArrayRef strides = in.x.strides();
+    ASSERT_EQ(sizes.size(), 3U);
+    EXPECT_EQ(in.x.numel(), sizes[0] * sizes[1] * sizes[2]);
+    EXPECT_EQ(strides[0], sizes[1] * sizes[2]);
+    EXPECT_EQ(strides[1], sizes[2]);
+    EXPECT_EQ(strides[2], 1);
+    EXPECT_EQ(in.x.storage().nbytes(),
+              static_cast<size_t>(in.x.numel()) * in.x.element_size());
+    file << std::to_string(in.x.numel()) << " ";
+    file << std::to_string(in.x.strides()[0]) << " ";
+  }
+  file << "\n";
+  file.saveFile();
+}
+
+}  // namespace test
+}  // namespace at
@@ -142,5 +142,27 @@ TEST_F(ListCompatTest, ListResizeVariants) {
   file.saveFile();
 }
 
+// 赋值共享同一份存储，copy() 是深拷贝
+TEST_F(ListCompatTest, ListCopyVersusShare) {
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "ListCopyVersusShare ";
+
+  c10::List<int64_t> list({0, 1, 2, 3});
+  c10::List<int64_t> shared = list;
+  c10::List<int64_t> copied = list.copy();
+  shared.set(0, 42);
+  copied.set(1, 7);
+  file << std::to_string(list.get(0)) << " ";
+  file << std::to_string(list.get(1)) << " ";
+  file << std::to_string(copied.get(0)) << " ";
+  file << std::to_string(copied.get(1)) << " ";
+  file << std::to_string(shared.size()) << " ";
+
+  file << "\n";
+  file.saveFile();
+}
+
 }  // namespace test
 }  // namespace at
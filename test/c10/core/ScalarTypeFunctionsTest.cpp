@@ -5,14 +5,25 @@
 #include <string>
 
 #include "src/file_manager.h"
+#include "src/scalar_type_fns.h"
 
 extern paddle_api_test::ThreadSafeParam g_custom_param;
 
 namespace at {
 namespace test {
 
+using paddle_api_test::CanCastFn;
+using paddle_api_test::ConstexprUsable;
+using paddle_api_test::ElementSizeFn;
 using paddle_api_test::FileManerger;
+using paddle_api_test::IsBinaryTypeFn;
+using paddle_api_test::IsComplexTypeFn;
+using paddle_api_test::IsFloatingTypeFn;
+using paddle_api_test::IsIntegralTypeFn;
+using paddle_api_test::IsReducedFloatingTypeFn;
+using paddle_api_test::PromoteTypesFn;
 using paddle_api_test::ThreadSafeParam;
+using paddle_api_test::ToAccumulateTypeFn;
 
 class ScalarTypeFunctionsTest : public ::testing::Test {
  protected:
@@ -146,5 +157,43 @@ TEST_F(ScalarTypeFunctionsTest, IsComplexType) {
   file.saveFile();
 }
 
+// 记录函数能否用于常量表达式（Torch 一侧即 API 允许的用法），可用时
+// 编译期求值的结果必须与运行期一致
+template <typename Fn>
+static void write_constexpr_usable(FileManerger* file, const char* api) {
+  *file << api << " " << std::to_string(ConstexprUsable<Fn>()) << " ";
+  if constexpr (ConstexprUsable<Fn>()) {
+    volatile c10::ScalarType half = c10::ScalarType::Half;
+    volatile c10::ScalarType flt = c10::ScalarType::Float;
+    if constexpr (IsBinaryTypeFn<Fn>()) {
+      constexpr auto folded =
+          Fn{}(c10::ScalarType::Half, c10::ScalarType::Float);
+      EXPECT_EQ(folded, Fn{}(half, flt)) << api;
+    } else {
+      constexpr auto folded = Fn{}(c10::ScalarType::Half);
+      EXPECT_EQ(folded, Fn{}(half)) << api;
+    }
+  }
+}
+
+// constexpr
+TEST_F(ScalarTypeFunctionsTest, ConstexprUsable) {
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "ConstexprUsable ";
+  write_constexpr_usable<ElementSizeFn>(&file, "elementSize");
+  write_constexpr_usable<IsFloatingTypeFn>(&file, "isFloatingType");
+  write_constexpr_usable<IsIntegralTypeFn>(&file, "isIntegralType");
+  write_constexpr_usable<IsComplexTypeFn>(&file, "isComplexType");
+  write_constexpr_usable<IsReducedFloatingTypeFn>(&file,
+                                                  "isReducedFloatingType");
+  write_constexpr_usable<PromoteTypesFn>(&file, "promoteTypes");
+  write_constexpr_usable<CanCastFn>(&file, "canCast");
+  write_constexpr_usable<ToAccumulateTypeFn>(&file, "toAccumulateType");
+  file << "\n";
+  file.saveFile();
+}
+
 }  // namespace test
 }  // namespace at
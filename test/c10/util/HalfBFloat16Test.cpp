@@ -4,7 +4,10 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "src/file_manager.h"
 
@@ -148,6 +151,259 @@ TEST_F(HalfBFloat16Test, BFloat16Namespace) {
   file.saveFile();
 }
 
+// ===================== 全部 65536 个位模式 =====================
+//
+// 与独立实现的参考转换逐位比较：16 位 -> float 是精确扩展，float ->
+// 16 位为 round-to-nearest-even。NaN 的 payload 与符号两端的处理可能
+// 不同（Torch 的 Half 统一为 0x7E00，BFloat16 统一为 0x7FC0），只要求
+// 结果仍是 NaN；各自的结果压缩为 FNV-1a 摘要输出，由 result_cmp.sh 比较
+// 两个框架是否逐位一致。
+
+static uint32_t float_bits(float value) {
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+static float float_from_bits(uint32_t bits) {
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+static bool is_float_nan_bits(uint32_t bits) {
+  return (bits & 0x7FFFFFFFu) > 0x7F800000u;
+}
+
+static uint64_t fnv1a(uint64_t hash, uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    hash ^= (value >> (8 * i)) & 0xFFu;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+
+// 两端的 Half / BFloat16 都公开 uint16_t 成员 x
+static c10::Half half_from_bits(uint16_t bits) {
+  c10::Half value;
+  value.x = bits;
+  return value;
+}
+
+static c10::BFloat16 bfloat16_from_bits(uint16_t bits) {
+  c10::BFloat16 value;
+  value.x = bits;
+  return value;
+}
+
+static bool is_half_nan_bits(uint16_t bits) {
+  return (bits & 0x7FFFu) > 0x7C00u;
+}
+
+static bool is_bfloat16_nan_bits(uint16_t bits) {
+  return (bits & 0x7FFFu) > 0x7F80u;
+}
+
+static float reference_half_to_float(uint16_t bits) {
+  const int exponent = (bits >> 10) & 0x1F;
+  const int mantissa = bits & 0x3FF;
+  float value;
+  if (exponent == 0x1F) {
+    value = mantissa == 0 ? INFINITY : NAN;
+  } else if (exponent == 0) {
+    value = std::ldexp(static_cast<float>(mantissa), -24);
+  } else {
+    value = std::ldexp(static_cast<float>(mantissa | 0x400), exponent - 25);
+  }
+  return (bits & 0x8000u) ? -value : value;
+}
+
+// 非 NaN 输入
+static uint16_t reference_float_to_half(uint32_t bits) {
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+  const uint32_t magnitude = bits & 0x7FFFFFFFu;
+  // 65520 及以上（含 inf）舍入到 inf
+  if (magnitude >= 0x477FF000u) {
+    return sign | 0x7C00u;
+  }
+  const uint32_t exponent = magnitude >> 23;
+  uint32_t mantissa = magnitude & 0x7FFFFFu;
+  uint32_t shift = 13;
+  uint32_t base = 0;
+  if (exponent < 113) {
+    // 结果为 Half 的非规格化数；小于 2^-25 的值舍入到 0
+    if (exponent < 102) {
+      return sign;
+    }
+    mantissa |= 0x800000u;
+    shift = 126 - exponent;
+  } else {
+    base = (exponent - 112) << 10;
+  }
+  uint32_t rounded = mantissa >> shift;
+  const uint32_t remainder = mantissa & ((1u << shift) - 1);
+  const uint32_t halfway = 1u << (shift - 1);
+  if (remainder > halfway || (remainder == halfway && (rounded & 1u))) {
+    ++rounded;
+  }
+  // 尾数进位会自然进入指数位
+  return static_cast<uint16_t>(sign | (base + rounded));
+}
+
+// 非 NaN 输入
+static uint16_t reference_float_to_bfloat16(uint32_t bits) {
+  const uint32_t rounding_bias = 0x7FFFu + ((bits >> 16) & 1u);
+  return static_cast<uint16_t>((bits + rounding_bias) >> 16);
+}
+
+// 额外的 float 输入：最大有限值附近、float 非规格化数与各种 NaN
+static void append_special_floats(std::vector<uint32_t>* inputs) {
+  for (uint32_t bits : {0x477FE000u,    // 65504，Half 最大有限值
+                        0x477FEFFFu,    // 略小于 65520
+                        0x477FF000u,    // 65520，Half 的 RNE 溢出点
+                        0x7F7FFFFFu,    // FLT_MAX
+                        0x00000001u,    // 最小 float 非规格化数
+                        0x33000000u,    // 2^-25
+                        0x7F800001u,    // signaling NaN
+                        0x7FC00000u,    // quiet NaN
+                        0x7FC00001u,    // 带 payload 的 quiet NaN
+                        0x7FFFFFFFu}) {
+    inputs->push_back(bits);
+    inputs->push_back(bits | 0x80000000u);
+  }
+}
+
+// 全部非 NaN 的 Half 值、相邻两值的中点与中点两侧各 1 ulp
+static std::vector<uint32_t> half_rounding_inputs() {
+  std::vector<uint32_t> inputs;
+  for (uint32_t h = 0; h <= 0xFFFFu; ++h) {
+    const uint16_t bits = static_cast<uint16_t>(h);
+    if (is_half_nan_bits(bits)) {
+      continue;
+    }
+    const float lo = reference_half_to_float(bits);
+    inputs.push_back(float_bits(lo));
+    if ((bits & 0x7FFFu) < 0x7BFFu) {
+      const float hi = reference_half_to_float(static_cast<uint16_t>(h + 1));
+      const uint32_t mid = float_bits(
+          static_cast<float>((static_cast<double>(lo) + hi) / 2.0));
+      inputs.push_back(mid - 1);
+      inputs.push_back(mid);
+      inputs.push_back(mid + 1);
+    }
+  }
+  append_special_floats(&inputs);
+  return inputs;
+}
+
+static std::vector<uint32_t> bfloat16_rounding_inputs() {
+  std::vector<uint32_t> inputs;
+  for (uint32_t h = 0; h <= 0xFFFFu; ++h) {
+    if (is_bfloat16_nan_bits(static_cast<uint16_t>(h))) {
+      continue;
+    }
+    const uint32_t lo = h << 16;
+    inputs.push_back(lo);
+    if ((h & 0x7FFFu) < 0x7F80u) {
+      inputs.push_back(lo | 0x7FFFu);
+      inputs.push_back(lo | 0x8000u);
+      inputs.push_back(lo | 0x8001u);
+    }
+  }
+  append_special_floats(&inputs);
+  return inputs;
+}
+
+// 输出：to_float 与 from_float 的参考不一致数、非 NaN 结果摘要、
+// 仍为 NaN 的 NaN 输入个数。NaN 的 payload 在软件转换与 F16C 等硬件
+// 转换之间可能不同，不计入摘要
+TEST_F(HalfBFloat16Test, HalfExhaustive) {
+  int64_t to_float_mismatches = 0;
+  int64_t from_float_mismatches = 0;
+  uint64_t finite_digest = kFnvOffsetBasis;
+  int64_t nan_preserved = 0;
+  for (uint32_t h = 0; h <= 0xFFFFu; ++h) {
+    const uint16_t bits = static_cast<uint16_t>(h);
+    const uint32_t got = float_bits(static_cast<float>(half_from_bits(bits)));
+    if (is_half_nan_bits(bits)) {
+      to_float_mismatches += is_float_nan_bits(got) ? 0 : 1;
+      nan_preserved += is_float_nan_bits(got) ? 1 : 0;
+    } else {
+      to_float_mismatches +=
+          got == float_bits(reference_half_to_float(bits)) ? 0 : 1;
+      finite_digest = fnv1a(finite_digest, got);
+    }
+  }
+  for (uint32_t input : half_rounding_inputs()) {
+    const uint16_t got = c10::Half(float_from_bits(input)).x;
+    if (is_float_nan_bits(input)) {
+      from_float_mismatches += is_half_nan_bits(got) ? 0 : 1;
+      nan_preserved += is_half_nan_bits(got) ? 1 : 0;
+    } else {
+      from_float_mismatches += got == reference_float_to_half(input) ? 0 : 1;
+      finite_digest = fnv1a(finite_digest, got);
+    }
+  }
+  EXPECT_EQ(to_float_mismatches, 0);
+  EXPECT_EQ(from_float_mismatches, 0);
+
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "HalfExhaustive ";
+  file << std::to_string(to_float_mismatches) << " ";
+  file << std::to_string(from_float_mismatches) << " ";
+  file << std::to_string(finite_digest) << " ";
+  file << std::to_string(nan_preserved) << " ";
+  file << "\n";
+  file.saveFile();
+}
+
+TEST_F(HalfBFloat16Test, BFloat16Exhaustive) {
+  int64_t to_float_mismatches = 0;
+  int64_t from_float_mismatches = 0;
+  uint64_t finite_digest = kFnvOffsetBasis;
+  int64_t nan_preserved = 0;
+  for (uint32_t h = 0; h <= 0xFFFFu; ++h) {
+    const uint16_t bits = static_cast<uint16_t>(h);
+    const uint32_t got =
+        float_bits(static_cast<float>(bfloat16_from_bits(bits)));
+    if (is_bfloat16_nan_bits(bits)) {
+      to_float_mismatches += is_float_nan_bits(got) ? 0 : 1;
+      nan_preserved += is_float_nan_bits(got) ? 1 : 0;
+    } else {
+      to_float_mismatches += got == (h << 16) ? 0 : 1;
+      finite_digest = fnv1a(finite_digest, got);
+    }
+  }
+  for (uint32_t input : bfloat16_rounding_inputs()) {
+    const uint16_t got = c10::BFloat16(float_from_bits(input)).x;
+    if (is_float_nan_bits(input)) {
+      from_float_mismatches += is_bfloat16_nan_bits(got) ? 0 : 1;
+      nan_preserved += is_bfloat16_nan_bits(got) ? 1 : 0;
+    } else {
+      from_float_mismatches +=
+          got == reference_float_to_bfloat16(input) ? 0 : 1;
+      finite_digest = fnv1a(finite_digest, got);
+    }
+  }
+  EXPECT_EQ(to_float_mismatches, 0);
+  EXPECT_EQ(from_float_mismatches, 0);
+
+  auto file_name = g_custom_param.get();
+  FileManerger file(file_name);
+  file.openAppend();
+  file << "BFloat16Exhaustive ";
+  file << std::to_string(to_float_mismatches) << " ";
+  file << std::to_string(from_float_mismatches) << " ";
+  file << std::to_string(finite_digest) << " ";
+  file << std::to_string(nan_preserved) << " ";
+  file << "\n";
+  file.saveFile();
+}
+
 // ScalarType 对应关系
 // [DIFF] PyTorch输出: 5 11, PaddlePaddle输出: 5 15 (BFloat16枚举值不同)
 TEST_F(HalfBFloat16Test, ScalarTypeMapping) {